@@ -0,0 +1,116 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS hdf5::hdf5-static hdf5::hdf5-shared hdf5::hdf5_tools-static hdf5::hdf5_tools-shared)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target hdf5::hdf5-static
+add_library(hdf5::hdf5-static STATIC IMPORTED)
+
+set_target_properties(hdf5::hdf5-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_par_build/src;/root/repo/src"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:m>;\$<LINK_ONLY:dl>;dl;Threads::Threads"
+)
+
+# Create imported target hdf5::hdf5-shared
+add_library(hdf5::hdf5-shared SHARED IMPORTED)
+
+set_target_properties(hdf5::hdf5-shared PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "H5_BUILT_AS_DYNAMIC_LIB=1"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_par_build/src;/root/repo/src"
+  INTERFACE_LINK_LIBRARIES "dl;Threads::Threads"
+)
+
+# Create imported target hdf5::hdf5_tools-static
+add_library(hdf5::hdf5_tools-static STATIC IMPORTED)
+
+set_target_properties(hdf5::hdf5_tools-static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_par_build/tools/lib;/root/repo/tools/lib"
+  INTERFACE_LINK_LIBRARIES "hdf5::hdf5-static"
+)
+
+# Create imported target hdf5::hdf5_tools-shared
+add_library(hdf5::hdf5_tools-shared SHARED IMPORTED)
+
+set_target_properties(hdf5::hdf5_tools-shared PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "H5_BUILT_AS_DYNAMIC_LIB=1"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/_par_build/tools/lib;/root/repo/tools/lib"
+  INTERFACE_LINK_LIBRARIES "hdf5::hdf5-shared"
+)
+
+# Import target "hdf5::hdf5-static" for configuration ""
+set_property(TARGET hdf5::hdf5-static APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf5::hdf5-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_par_build/bin/libhdf5.a"
+  )
+
+# Import target "hdf5::hdf5-shared" for configuration ""
+set_property(TARGET hdf5::hdf5-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf5::hdf5-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_par_build/bin/libhdf5.so.1.11.0"
+  IMPORTED_SONAME_NOCONFIG "libhdf5.so.1000.0.0"
+  )
+
+# Import target "hdf5::hdf5_tools-static" for configuration ""
+set_property(TARGET hdf5::hdf5_tools-static APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf5::hdf5_tools-static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_par_build/bin/libhdf5_tools.a"
+  )
+
+# Import target "hdf5::hdf5_tools-shared" for configuration ""
+set_property(TARGET hdf5::hdf5_tools-shared APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf5::hdf5_tools-shared PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/root/repo/_par_build/bin/libhdf5_tools.so.1.11.0"
+  IMPORTED_SONAME_NOCONFIG "libhdf5_tools.so.1000.0.0"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
@@ -0,0 +1,330 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/H5.c" "src/CMakeFiles/hdf5-shared.dir/H5.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5.c.o.d"
+  "/root/repo/src/H5A.c" "src/CMakeFiles/hdf5-shared.dir/H5A.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5A.c.o.d"
+  "/root/repo/src/H5AC.c" "src/CMakeFiles/hdf5-shared.dir/H5AC.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5AC.c.o.d"
+  "/root/repo/src/H5ACdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5ACdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5ACdbg.c.o.d"
+  "/root/repo/src/H5AClog.c" "src/CMakeFiles/hdf5-shared.dir/H5AClog.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5AClog.c.o.d"
+  "/root/repo/src/H5ACmpio.c" "src/CMakeFiles/hdf5-shared.dir/H5ACmpio.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5ACmpio.c.o.d"
+  "/root/repo/src/H5ACproxy_entry.c" "src/CMakeFiles/hdf5-shared.dir/H5ACproxy_entry.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5ACproxy_entry.c.o.d"
+  "/root/repo/src/H5Abtree2.c" "src/CMakeFiles/hdf5-shared.dir/H5Abtree2.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Abtree2.c.o.d"
+  "/root/repo/src/H5Adense.c" "src/CMakeFiles/hdf5-shared.dir/H5Adense.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Adense.c.o.d"
+  "/root/repo/src/H5Adeprec.c" "src/CMakeFiles/hdf5-shared.dir/H5Adeprec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Adeprec.c.o.d"
+  "/root/repo/src/H5Aint.c" "src/CMakeFiles/hdf5-shared.dir/H5Aint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Aint.c.o.d"
+  "/root/repo/src/H5Atest.c" "src/CMakeFiles/hdf5-shared.dir/H5Atest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Atest.c.o.d"
+  "/root/repo/src/H5B.c" "src/CMakeFiles/hdf5-shared.dir/H5B.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B.c.o.d"
+  "/root/repo/src/H5B2.c" "src/CMakeFiles/hdf5-shared.dir/H5B2.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B2.c.o.d"
+  "/root/repo/src/H5B2cache.c" "src/CMakeFiles/hdf5-shared.dir/H5B2cache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B2cache.c.o.d"
+  "/root/repo/src/H5B2dbg.c" "src/CMakeFiles/hdf5-shared.dir/H5B2dbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B2dbg.c.o.d"
+  "/root/repo/src/H5B2hdr.c" "src/CMakeFiles/hdf5-shared.dir/H5B2hdr.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B2hdr.c.o.d"
+  "/root/repo/src/H5B2int.c" "src/CMakeFiles/hdf5-shared.dir/H5B2int.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B2int.c.o.d"
+  "/root/repo/src/H5B2internal.c" "src/CMakeFiles/hdf5-shared.dir/H5B2internal.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B2internal.c.o.d"
+  "/root/repo/src/H5B2leaf.c" "src/CMakeFiles/hdf5-shared.dir/H5B2leaf.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B2leaf.c.o.d"
+  "/root/repo/src/H5B2stat.c" "src/CMakeFiles/hdf5-shared.dir/H5B2stat.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B2stat.c.o.d"
+  "/root/repo/src/H5B2test.c" "src/CMakeFiles/hdf5-shared.dir/H5B2test.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5B2test.c.o.d"
+  "/root/repo/src/H5Bcache.c" "src/CMakeFiles/hdf5-shared.dir/H5Bcache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Bcache.c.o.d"
+  "/root/repo/src/H5Bdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5Bdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Bdbg.c.o.d"
+  "/root/repo/src/H5C.c" "src/CMakeFiles/hdf5-shared.dir/H5C.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5C.c.o.d"
+  "/root/repo/src/H5CS.c" "src/CMakeFiles/hdf5-shared.dir/H5CS.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5CS.c.o.d"
+  "/root/repo/src/H5Cdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5Cdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Cdbg.c.o.d"
+  "/root/repo/src/H5Cepoch.c" "src/CMakeFiles/hdf5-shared.dir/H5Cepoch.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Cepoch.c.o.d"
+  "/root/repo/src/H5Cimage.c" "src/CMakeFiles/hdf5-shared.dir/H5Cimage.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Cimage.c.o.d"
+  "/root/repo/src/H5Clog.c" "src/CMakeFiles/hdf5-shared.dir/H5Clog.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Clog.c.o.d"
+  "/root/repo/src/H5Cmpio.c" "src/CMakeFiles/hdf5-shared.dir/H5Cmpio.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Cmpio.c.o.d"
+  "/root/repo/src/H5Cprefetched.c" "src/CMakeFiles/hdf5-shared.dir/H5Cprefetched.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Cprefetched.c.o.d"
+  "/root/repo/src/H5Cquery.c" "src/CMakeFiles/hdf5-shared.dir/H5Cquery.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Cquery.c.o.d"
+  "/root/repo/src/H5Ctag.c" "src/CMakeFiles/hdf5-shared.dir/H5Ctag.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ctag.c.o.d"
+  "/root/repo/src/H5Ctest.c" "src/CMakeFiles/hdf5-shared.dir/H5Ctest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ctest.c.o.d"
+  "/root/repo/src/H5D.c" "src/CMakeFiles/hdf5-shared.dir/H5D.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5D.c.o.d"
+  "/root/repo/src/H5Dbtree.c" "src/CMakeFiles/hdf5-shared.dir/H5Dbtree.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dbtree.c.o.d"
+  "/root/repo/src/H5Dbtree2.c" "src/CMakeFiles/hdf5-shared.dir/H5Dbtree2.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dbtree2.c.o.d"
+  "/root/repo/src/H5Dchunk.c" "src/CMakeFiles/hdf5-shared.dir/H5Dchunk.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dchunk.c.o.d"
+  "/root/repo/src/H5Dcompact.c" "src/CMakeFiles/hdf5-shared.dir/H5Dcompact.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dcompact.c.o.d"
+  "/root/repo/src/H5Dcontig.c" "src/CMakeFiles/hdf5-shared.dir/H5Dcontig.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dcontig.c.o.d"
+  "/root/repo/src/H5Ddbg.c" "src/CMakeFiles/hdf5-shared.dir/H5Ddbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ddbg.c.o.d"
+  "/root/repo/src/H5Ddeprec.c" "src/CMakeFiles/hdf5-shared.dir/H5Ddeprec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ddeprec.c.o.d"
+  "/root/repo/src/H5Dearray.c" "src/CMakeFiles/hdf5-shared.dir/H5Dearray.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dearray.c.o.d"
+  "/root/repo/src/H5Defl.c" "src/CMakeFiles/hdf5-shared.dir/H5Defl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Defl.c.o.d"
+  "/root/repo/src/H5Dfarray.c" "src/CMakeFiles/hdf5-shared.dir/H5Dfarray.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dfarray.c.o.d"
+  "/root/repo/src/H5Dfill.c" "src/CMakeFiles/hdf5-shared.dir/H5Dfill.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dfill.c.o.d"
+  "/root/repo/src/H5Dint.c" "src/CMakeFiles/hdf5-shared.dir/H5Dint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dint.c.o.d"
+  "/root/repo/src/H5Dio.c" "src/CMakeFiles/hdf5-shared.dir/H5Dio.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dio.c.o.d"
+  "/root/repo/src/H5Dlayout.c" "src/CMakeFiles/hdf5-shared.dir/H5Dlayout.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dlayout.c.o.d"
+  "/root/repo/src/H5Dmpio.c" "src/CMakeFiles/hdf5-shared.dir/H5Dmpio.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dmpio.c.o.d"
+  "/root/repo/src/H5Dnone.c" "src/CMakeFiles/hdf5-shared.dir/H5Dnone.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dnone.c.o.d"
+  "/root/repo/src/H5Doh.c" "src/CMakeFiles/hdf5-shared.dir/H5Doh.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Doh.c.o.d"
+  "/root/repo/src/H5Dscatgath.c" "src/CMakeFiles/hdf5-shared.dir/H5Dscatgath.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dscatgath.c.o.d"
+  "/root/repo/src/H5Dselect.c" "src/CMakeFiles/hdf5-shared.dir/H5Dselect.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dselect.c.o.d"
+  "/root/repo/src/H5Dsingle.c" "src/CMakeFiles/hdf5-shared.dir/H5Dsingle.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dsingle.c.o.d"
+  "/root/repo/src/H5Dtest.c" "src/CMakeFiles/hdf5-shared.dir/H5Dtest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dtest.c.o.d"
+  "/root/repo/src/H5Dvirtual.c" "src/CMakeFiles/hdf5-shared.dir/H5Dvirtual.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Dvirtual.c.o.d"
+  "/root/repo/src/H5E.c" "src/CMakeFiles/hdf5-shared.dir/H5E.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5E.c.o.d"
+  "/root/repo/src/H5EA.c" "src/CMakeFiles/hdf5-shared.dir/H5EA.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EA.c.o.d"
+  "/root/repo/src/H5EAcache.c" "src/CMakeFiles/hdf5-shared.dir/H5EAcache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAcache.c.o.d"
+  "/root/repo/src/H5EAdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5EAdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAdbg.c.o.d"
+  "/root/repo/src/H5EAdblkpage.c" "src/CMakeFiles/hdf5-shared.dir/H5EAdblkpage.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAdblkpage.c.o.d"
+  "/root/repo/src/H5EAdblock.c" "src/CMakeFiles/hdf5-shared.dir/H5EAdblock.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAdblock.c.o.d"
+  "/root/repo/src/H5EAhdr.c" "src/CMakeFiles/hdf5-shared.dir/H5EAhdr.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAhdr.c.o.d"
+  "/root/repo/src/H5EAiblock.c" "src/CMakeFiles/hdf5-shared.dir/H5EAiblock.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAiblock.c.o.d"
+  "/root/repo/src/H5EAint.c" "src/CMakeFiles/hdf5-shared.dir/H5EAint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAint.c.o.d"
+  "/root/repo/src/H5EAsblock.c" "src/CMakeFiles/hdf5-shared.dir/H5EAsblock.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAsblock.c.o.d"
+  "/root/repo/src/H5EAstat.c" "src/CMakeFiles/hdf5-shared.dir/H5EAstat.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAstat.c.o.d"
+  "/root/repo/src/H5EAtest.c" "src/CMakeFiles/hdf5-shared.dir/H5EAtest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5EAtest.c.o.d"
+  "/root/repo/src/H5Edeprec.c" "src/CMakeFiles/hdf5-shared.dir/H5Edeprec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Edeprec.c.o.d"
+  "/root/repo/src/H5Eint.c" "src/CMakeFiles/hdf5-shared.dir/H5Eint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Eint.c.o.d"
+  "/root/repo/src/H5F.c" "src/CMakeFiles/hdf5-shared.dir/H5F.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5F.c.o.d"
+  "/root/repo/src/H5FA.c" "src/CMakeFiles/hdf5-shared.dir/H5FA.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FA.c.o.d"
+  "/root/repo/src/H5FAcache.c" "src/CMakeFiles/hdf5-shared.dir/H5FAcache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FAcache.c.o.d"
+  "/root/repo/src/H5FAdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5FAdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FAdbg.c.o.d"
+  "/root/repo/src/H5FAdblkpage.c" "src/CMakeFiles/hdf5-shared.dir/H5FAdblkpage.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FAdblkpage.c.o.d"
+  "/root/repo/src/H5FAdblock.c" "src/CMakeFiles/hdf5-shared.dir/H5FAdblock.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FAdblock.c.o.d"
+  "/root/repo/src/H5FAhdr.c" "src/CMakeFiles/hdf5-shared.dir/H5FAhdr.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FAhdr.c.o.d"
+  "/root/repo/src/H5FAint.c" "src/CMakeFiles/hdf5-shared.dir/H5FAint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FAint.c.o.d"
+  "/root/repo/src/H5FAstat.c" "src/CMakeFiles/hdf5-shared.dir/H5FAstat.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FAstat.c.o.d"
+  "/root/repo/src/H5FAtest.c" "src/CMakeFiles/hdf5-shared.dir/H5FAtest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FAtest.c.o.d"
+  "/root/repo/src/H5FD.c" "src/CMakeFiles/hdf5-shared.dir/H5FD.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FD.c.o.d"
+  "/root/repo/src/H5FDcore.c" "src/CMakeFiles/hdf5-shared.dir/H5FDcore.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDcore.c.o.d"
+  "/root/repo/src/H5FDdirect.c" "src/CMakeFiles/hdf5-shared.dir/H5FDdirect.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDdirect.c.o.d"
+  "/root/repo/src/H5FDfamily.c" "src/CMakeFiles/hdf5-shared.dir/H5FDfamily.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDfamily.c.o.d"
+  "/root/repo/src/H5FDint.c" "src/CMakeFiles/hdf5-shared.dir/H5FDint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDint.c.o.d"
+  "/root/repo/src/H5FDlog.c" "src/CMakeFiles/hdf5-shared.dir/H5FDlog.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDlog.c.o.d"
+  "/root/repo/src/H5FDmmap.c" "src/CMakeFiles/hdf5-shared.dir/H5FDmmap.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDmmap.c.o.d"
+  "/root/repo/src/H5FDmpi.c" "src/CMakeFiles/hdf5-shared.dir/H5FDmpi.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDmpi.c.o.d"
+  "/root/repo/src/H5FDmpio.c" "src/CMakeFiles/hdf5-shared.dir/H5FDmpio.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDmpio.c.o.d"
+  "/root/repo/src/H5FDmulti.c" "src/CMakeFiles/hdf5-shared.dir/H5FDmulti.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDmulti.c.o.d"
+  "/root/repo/src/H5FDsec2.c" "src/CMakeFiles/hdf5-shared.dir/H5FDsec2.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDsec2.c.o.d"
+  "/root/repo/src/H5FDspace.c" "src/CMakeFiles/hdf5-shared.dir/H5FDspace.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDspace.c.o.d"
+  "/root/repo/src/H5FDstdio.c" "src/CMakeFiles/hdf5-shared.dir/H5FDstdio.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDstdio.c.o.d"
+  "/root/repo/src/H5FDtest.c" "src/CMakeFiles/hdf5-shared.dir/H5FDtest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDtest.c.o.d"
+  "/root/repo/src/H5FDuring.c" "src/CMakeFiles/hdf5-shared.dir/H5FDuring.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDuring.c.o.d"
+  "/root/repo/src/H5FDwindows.c" "src/CMakeFiles/hdf5-shared.dir/H5FDwindows.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FDwindows.c.o.d"
+  "/root/repo/src/H5FL.c" "src/CMakeFiles/hdf5-shared.dir/H5FL.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FL.c.o.d"
+  "/root/repo/src/H5FO.c" "src/CMakeFiles/hdf5-shared.dir/H5FO.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FO.c.o.d"
+  "/root/repo/src/H5FS.c" "src/CMakeFiles/hdf5-shared.dir/H5FS.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FS.c.o.d"
+  "/root/repo/src/H5FScache.c" "src/CMakeFiles/hdf5-shared.dir/H5FScache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FScache.c.o.d"
+  "/root/repo/src/H5FSdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5FSdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FSdbg.c.o.d"
+  "/root/repo/src/H5FSint.c" "src/CMakeFiles/hdf5-shared.dir/H5FSint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FSint.c.o.d"
+  "/root/repo/src/H5FSsection.c" "src/CMakeFiles/hdf5-shared.dir/H5FSsection.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FSsection.c.o.d"
+  "/root/repo/src/H5FSstat.c" "src/CMakeFiles/hdf5-shared.dir/H5FSstat.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FSstat.c.o.d"
+  "/root/repo/src/H5FStest.c" "src/CMakeFiles/hdf5-shared.dir/H5FStest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5FStest.c.o.d"
+  "/root/repo/src/H5Faccum.c" "src/CMakeFiles/hdf5-shared.dir/H5Faccum.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Faccum.c.o.d"
+  "/root/repo/src/H5Fcwfs.c" "src/CMakeFiles/hdf5-shared.dir/H5Fcwfs.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fcwfs.c.o.d"
+  "/root/repo/src/H5Fdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5Fdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fdbg.c.o.d"
+  "/root/repo/src/H5Fdeprec.c" "src/CMakeFiles/hdf5-shared.dir/H5Fdeprec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fdeprec.c.o.d"
+  "/root/repo/src/H5Fefc.c" "src/CMakeFiles/hdf5-shared.dir/H5Fefc.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fefc.c.o.d"
+  "/root/repo/src/H5Ffake.c" "src/CMakeFiles/hdf5-shared.dir/H5Ffake.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ffake.c.o.d"
+  "/root/repo/src/H5Fint.c" "src/CMakeFiles/hdf5-shared.dir/H5Fint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fint.c.o.d"
+  "/root/repo/src/H5Fio.c" "src/CMakeFiles/hdf5-shared.dir/H5Fio.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fio.c.o.d"
+  "/root/repo/src/H5Fmount.c" "src/CMakeFiles/hdf5-shared.dir/H5Fmount.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fmount.c.o.d"
+  "/root/repo/src/H5Fmpi.c" "src/CMakeFiles/hdf5-shared.dir/H5Fmpi.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fmpi.c.o.d"
+  "/root/repo/src/H5Fquery.c" "src/CMakeFiles/hdf5-shared.dir/H5Fquery.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fquery.c.o.d"
+  "/root/repo/src/H5Fsfile.c" "src/CMakeFiles/hdf5-shared.dir/H5Fsfile.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fsfile.c.o.d"
+  "/root/repo/src/H5Fspace.c" "src/CMakeFiles/hdf5-shared.dir/H5Fspace.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fspace.c.o.d"
+  "/root/repo/src/H5Fsuper.c" "src/CMakeFiles/hdf5-shared.dir/H5Fsuper.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fsuper.c.o.d"
+  "/root/repo/src/H5Fsuper_cache.c" "src/CMakeFiles/hdf5-shared.dir/H5Fsuper_cache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Fsuper_cache.c.o.d"
+  "/root/repo/src/H5Ftest.c" "src/CMakeFiles/hdf5-shared.dir/H5Ftest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ftest.c.o.d"
+  "/root/repo/src/H5G.c" "src/CMakeFiles/hdf5-shared.dir/H5G.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5G.c.o.d"
+  "/root/repo/src/H5Gbtree2.c" "src/CMakeFiles/hdf5-shared.dir/H5Gbtree2.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gbtree2.c.o.d"
+  "/root/repo/src/H5Gcache.c" "src/CMakeFiles/hdf5-shared.dir/H5Gcache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gcache.c.o.d"
+  "/root/repo/src/H5Gcompact.c" "src/CMakeFiles/hdf5-shared.dir/H5Gcompact.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gcompact.c.o.d"
+  "/root/repo/src/H5Gdense.c" "src/CMakeFiles/hdf5-shared.dir/H5Gdense.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gdense.c.o.d"
+  "/root/repo/src/H5Gdeprec.c" "src/CMakeFiles/hdf5-shared.dir/H5Gdeprec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gdeprec.c.o.d"
+  "/root/repo/src/H5Gent.c" "src/CMakeFiles/hdf5-shared.dir/H5Gent.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gent.c.o.d"
+  "/root/repo/src/H5Gint.c" "src/CMakeFiles/hdf5-shared.dir/H5Gint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gint.c.o.d"
+  "/root/repo/src/H5Glink.c" "src/CMakeFiles/hdf5-shared.dir/H5Glink.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Glink.c.o.d"
+  "/root/repo/src/H5Gloc.c" "src/CMakeFiles/hdf5-shared.dir/H5Gloc.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gloc.c.o.d"
+  "/root/repo/src/H5Gname.c" "src/CMakeFiles/hdf5-shared.dir/H5Gname.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gname.c.o.d"
+  "/root/repo/src/H5Gnode.c" "src/CMakeFiles/hdf5-shared.dir/H5Gnode.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gnode.c.o.d"
+  "/root/repo/src/H5Gobj.c" "src/CMakeFiles/hdf5-shared.dir/H5Gobj.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gobj.c.o.d"
+  "/root/repo/src/H5Goh.c" "src/CMakeFiles/hdf5-shared.dir/H5Goh.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Goh.c.o.d"
+  "/root/repo/src/H5Groot.c" "src/CMakeFiles/hdf5-shared.dir/H5Groot.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Groot.c.o.d"
+  "/root/repo/src/H5Gstab.c" "src/CMakeFiles/hdf5-shared.dir/H5Gstab.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gstab.c.o.d"
+  "/root/repo/src/H5Gtest.c" "src/CMakeFiles/hdf5-shared.dir/H5Gtest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gtest.c.o.d"
+  "/root/repo/src/H5Gtraverse.c" "src/CMakeFiles/hdf5-shared.dir/H5Gtraverse.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Gtraverse.c.o.d"
+  "/root/repo/src/H5HF.c" "src/CMakeFiles/hdf5-shared.dir/H5HF.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HF.c.o.d"
+  "/root/repo/src/H5HFbtree2.c" "src/CMakeFiles/hdf5-shared.dir/H5HFbtree2.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFbtree2.c.o.d"
+  "/root/repo/src/H5HFcache.c" "src/CMakeFiles/hdf5-shared.dir/H5HFcache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFcache.c.o.d"
+  "/root/repo/src/H5HFdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5HFdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFdbg.c.o.d"
+  "/root/repo/src/H5HFdblock.c" "src/CMakeFiles/hdf5-shared.dir/H5HFdblock.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFdblock.c.o.d"
+  "/root/repo/src/H5HFdtable.c" "src/CMakeFiles/hdf5-shared.dir/H5HFdtable.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFdtable.c.o.d"
+  "/root/repo/src/H5HFhdr.c" "src/CMakeFiles/hdf5-shared.dir/H5HFhdr.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFhdr.c.o.d"
+  "/root/repo/src/H5HFhuge.c" "src/CMakeFiles/hdf5-shared.dir/H5HFhuge.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFhuge.c.o.d"
+  "/root/repo/src/H5HFiblock.c" "src/CMakeFiles/hdf5-shared.dir/H5HFiblock.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFiblock.c.o.d"
+  "/root/repo/src/H5HFiter.c" "src/CMakeFiles/hdf5-shared.dir/H5HFiter.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFiter.c.o.d"
+  "/root/repo/src/H5HFman.c" "src/CMakeFiles/hdf5-shared.dir/H5HFman.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFman.c.o.d"
+  "/root/repo/src/H5HFsection.c" "src/CMakeFiles/hdf5-shared.dir/H5HFsection.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFsection.c.o.d"
+  "/root/repo/src/H5HFspace.c" "src/CMakeFiles/hdf5-shared.dir/H5HFspace.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFspace.c.o.d"
+  "/root/repo/src/H5HFstat.c" "src/CMakeFiles/hdf5-shared.dir/H5HFstat.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFstat.c.o.d"
+  "/root/repo/src/H5HFtest.c" "src/CMakeFiles/hdf5-shared.dir/H5HFtest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFtest.c.o.d"
+  "/root/repo/src/H5HFtiny.c" "src/CMakeFiles/hdf5-shared.dir/H5HFtiny.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HFtiny.c.o.d"
+  "/root/repo/src/H5HG.c" "src/CMakeFiles/hdf5-shared.dir/H5HG.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HG.c.o.d"
+  "/root/repo/src/H5HGcache.c" "src/CMakeFiles/hdf5-shared.dir/H5HGcache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HGcache.c.o.d"
+  "/root/repo/src/H5HGdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5HGdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HGdbg.c.o.d"
+  "/root/repo/src/H5HGquery.c" "src/CMakeFiles/hdf5-shared.dir/H5HGquery.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HGquery.c.o.d"
+  "/root/repo/src/H5HL.c" "src/CMakeFiles/hdf5-shared.dir/H5HL.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HL.c.o.d"
+  "/root/repo/src/H5HLcache.c" "src/CMakeFiles/hdf5-shared.dir/H5HLcache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HLcache.c.o.d"
+  "/root/repo/src/H5HLdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5HLdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HLdbg.c.o.d"
+  "/root/repo/src/H5HLdblk.c" "src/CMakeFiles/hdf5-shared.dir/H5HLdblk.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HLdblk.c.o.d"
+  "/root/repo/src/H5HLint.c" "src/CMakeFiles/hdf5-shared.dir/H5HLint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HLint.c.o.d"
+  "/root/repo/src/H5HLprfx.c" "src/CMakeFiles/hdf5-shared.dir/H5HLprfx.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HLprfx.c.o.d"
+  "/root/repo/src/H5HP.c" "src/CMakeFiles/hdf5-shared.dir/H5HP.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5HP.c.o.d"
+  "/root/repo/src/H5I.c" "src/CMakeFiles/hdf5-shared.dir/H5I.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5I.c.o.d"
+  "/root/repo/src/H5Itest.c" "src/CMakeFiles/hdf5-shared.dir/H5Itest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Itest.c.o.d"
+  "/root/repo/src/H5L.c" "src/CMakeFiles/hdf5-shared.dir/H5L.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5L.c.o.d"
+  "/root/repo/src/H5Lexternal.c" "src/CMakeFiles/hdf5-shared.dir/H5Lexternal.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Lexternal.c.o.d"
+  "/root/repo/src/H5MF.c" "src/CMakeFiles/hdf5-shared.dir/H5MF.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5MF.c.o.d"
+  "/root/repo/src/H5MFaggr.c" "src/CMakeFiles/hdf5-shared.dir/H5MFaggr.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5MFaggr.c.o.d"
+  "/root/repo/src/H5MFdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5MFdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5MFdbg.c.o.d"
+  "/root/repo/src/H5MFsection.c" "src/CMakeFiles/hdf5-shared.dir/H5MFsection.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5MFsection.c.o.d"
+  "/root/repo/src/H5MM.c" "src/CMakeFiles/hdf5-shared.dir/H5MM.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5MM.c.o.d"
+  "/root/repo/src/H5MP.c" "src/CMakeFiles/hdf5-shared.dir/H5MP.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5MP.c.o.d"
+  "/root/repo/src/H5MPtest.c" "src/CMakeFiles/hdf5-shared.dir/H5MPtest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5MPtest.c.o.d"
+  "/root/repo/src/H5O.c" "src/CMakeFiles/hdf5-shared.dir/H5O.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5O.c.o.d"
+  "/root/repo/src/H5Oainfo.c" "src/CMakeFiles/hdf5-shared.dir/H5Oainfo.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oainfo.c.o.d"
+  "/root/repo/src/H5Oalloc.c" "src/CMakeFiles/hdf5-shared.dir/H5Oalloc.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oalloc.c.o.d"
+  "/root/repo/src/H5Oattr.c" "src/CMakeFiles/hdf5-shared.dir/H5Oattr.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oattr.c.o.d"
+  "/root/repo/src/H5Oattribute.c" "src/CMakeFiles/hdf5-shared.dir/H5Oattribute.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oattribute.c.o.d"
+  "/root/repo/src/H5Obogus.c" "src/CMakeFiles/hdf5-shared.dir/H5Obogus.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Obogus.c.o.d"
+  "/root/repo/src/H5Obtreek.c" "src/CMakeFiles/hdf5-shared.dir/H5Obtreek.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Obtreek.c.o.d"
+  "/root/repo/src/H5Ocache.c" "src/CMakeFiles/hdf5-shared.dir/H5Ocache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ocache.c.o.d"
+  "/root/repo/src/H5Ocache_image.c" "src/CMakeFiles/hdf5-shared.dir/H5Ocache_image.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ocache_image.c.o.d"
+  "/root/repo/src/H5Ochunk.c" "src/CMakeFiles/hdf5-shared.dir/H5Ochunk.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ochunk.c.o.d"
+  "/root/repo/src/H5Ocont.c" "src/CMakeFiles/hdf5-shared.dir/H5Ocont.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ocont.c.o.d"
+  "/root/repo/src/H5Ocopy.c" "src/CMakeFiles/hdf5-shared.dir/H5Ocopy.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ocopy.c.o.d"
+  "/root/repo/src/H5Odbg.c" "src/CMakeFiles/hdf5-shared.dir/H5Odbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Odbg.c.o.d"
+  "/root/repo/src/H5Odrvinfo.c" "src/CMakeFiles/hdf5-shared.dir/H5Odrvinfo.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Odrvinfo.c.o.d"
+  "/root/repo/src/H5Odtype.c" "src/CMakeFiles/hdf5-shared.dir/H5Odtype.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Odtype.c.o.d"
+  "/root/repo/src/H5Oefl.c" "src/CMakeFiles/hdf5-shared.dir/H5Oefl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oefl.c.o.d"
+  "/root/repo/src/H5Ofill.c" "src/CMakeFiles/hdf5-shared.dir/H5Ofill.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ofill.c.o.d"
+  "/root/repo/src/H5Oflush.c" "src/CMakeFiles/hdf5-shared.dir/H5Oflush.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oflush.c.o.d"
+  "/root/repo/src/H5Ofsinfo.c" "src/CMakeFiles/hdf5-shared.dir/H5Ofsinfo.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ofsinfo.c.o.d"
+  "/root/repo/src/H5Oginfo.c" "src/CMakeFiles/hdf5-shared.dir/H5Oginfo.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oginfo.c.o.d"
+  "/root/repo/src/H5Oint.c" "src/CMakeFiles/hdf5-shared.dir/H5Oint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oint.c.o.d"
+  "/root/repo/src/H5Olayout.c" "src/CMakeFiles/hdf5-shared.dir/H5Olayout.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Olayout.c.o.d"
+  "/root/repo/src/H5Olinfo.c" "src/CMakeFiles/hdf5-shared.dir/H5Olinfo.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Olinfo.c.o.d"
+  "/root/repo/src/H5Olink.c" "src/CMakeFiles/hdf5-shared.dir/H5Olink.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Olink.c.o.d"
+  "/root/repo/src/H5Omessage.c" "src/CMakeFiles/hdf5-shared.dir/H5Omessage.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Omessage.c.o.d"
+  "/root/repo/src/H5Omtime.c" "src/CMakeFiles/hdf5-shared.dir/H5Omtime.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Omtime.c.o.d"
+  "/root/repo/src/H5Oname.c" "src/CMakeFiles/hdf5-shared.dir/H5Oname.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oname.c.o.d"
+  "/root/repo/src/H5Onull.c" "src/CMakeFiles/hdf5-shared.dir/H5Onull.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Onull.c.o.d"
+  "/root/repo/src/H5Opline.c" "src/CMakeFiles/hdf5-shared.dir/H5Opline.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Opline.c.o.d"
+  "/root/repo/src/H5Orefcount.c" "src/CMakeFiles/hdf5-shared.dir/H5Orefcount.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Orefcount.c.o.d"
+  "/root/repo/src/H5Osdspace.c" "src/CMakeFiles/hdf5-shared.dir/H5Osdspace.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Osdspace.c.o.d"
+  "/root/repo/src/H5Oshared.c" "src/CMakeFiles/hdf5-shared.dir/H5Oshared.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oshared.c.o.d"
+  "/root/repo/src/H5Oshmesg.c" "src/CMakeFiles/hdf5-shared.dir/H5Oshmesg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Oshmesg.c.o.d"
+  "/root/repo/src/H5Ostab.c" "src/CMakeFiles/hdf5-shared.dir/H5Ostab.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ostab.c.o.d"
+  "/root/repo/src/H5Otest.c" "src/CMakeFiles/hdf5-shared.dir/H5Otest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Otest.c.o.d"
+  "/root/repo/src/H5Ounknown.c" "src/CMakeFiles/hdf5-shared.dir/H5Ounknown.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ounknown.c.o.d"
+  "/root/repo/src/H5P.c" "src/CMakeFiles/hdf5-shared.dir/H5P.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5P.c.o.d"
+  "/root/repo/src/H5PB.c" "src/CMakeFiles/hdf5-shared.dir/H5PB.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5PB.c.o.d"
+  "/root/repo/src/H5PL.c" "src/CMakeFiles/hdf5-shared.dir/H5PL.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5PL.c.o.d"
+  "/root/repo/src/H5PLint.c" "src/CMakeFiles/hdf5-shared.dir/H5PLint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5PLint.c.o.d"
+  "/root/repo/src/H5PLpath.c" "src/CMakeFiles/hdf5-shared.dir/H5PLpath.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5PLpath.c.o.d"
+  "/root/repo/src/H5PLplugin_cache.c" "src/CMakeFiles/hdf5-shared.dir/H5PLplugin_cache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5PLplugin_cache.c.o.d"
+  "/root/repo/src/H5Pacpl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pacpl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pacpl.c.o.d"
+  "/root/repo/src/H5Pdapl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pdapl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pdapl.c.o.d"
+  "/root/repo/src/H5Pdcpl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pdcpl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pdcpl.c.o.d"
+  "/root/repo/src/H5Pdeprec.c" "src/CMakeFiles/hdf5-shared.dir/H5Pdeprec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pdeprec.c.o.d"
+  "/root/repo/src/H5Pdxpl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pdxpl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pdxpl.c.o.d"
+  "/root/repo/src/H5Pencdec.c" "src/CMakeFiles/hdf5-shared.dir/H5Pencdec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pencdec.c.o.d"
+  "/root/repo/src/H5Pfapl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pfapl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pfapl.c.o.d"
+  "/root/repo/src/H5Pfcpl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pfcpl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pfcpl.c.o.d"
+  "/root/repo/src/H5Pfmpl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pfmpl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pfmpl.c.o.d"
+  "/root/repo/src/H5Pgcpl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pgcpl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pgcpl.c.o.d"
+  "/root/repo/src/H5Pint.c" "src/CMakeFiles/hdf5-shared.dir/H5Pint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pint.c.o.d"
+  "/root/repo/src/H5Plapl.c" "src/CMakeFiles/hdf5-shared.dir/H5Plapl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Plapl.c.o.d"
+  "/root/repo/src/H5Plcpl.c" "src/CMakeFiles/hdf5-shared.dir/H5Plcpl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Plcpl.c.o.d"
+  "/root/repo/src/H5Pocpl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pocpl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pocpl.c.o.d"
+  "/root/repo/src/H5Pocpypl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pocpypl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pocpypl.c.o.d"
+  "/root/repo/src/H5Pstrcpl.c" "src/CMakeFiles/hdf5-shared.dir/H5Pstrcpl.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Pstrcpl.c.o.d"
+  "/root/repo/src/H5Ptest.c" "src/CMakeFiles/hdf5-shared.dir/H5Ptest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ptest.c.o.d"
+  "/root/repo/src/H5R.c" "src/CMakeFiles/hdf5-shared.dir/H5R.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5R.c.o.d"
+  "/root/repo/src/H5RQ.c" "src/CMakeFiles/hdf5-shared.dir/H5RQ.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5RQ.c.o.d"
+  "/root/repo/src/H5RQint.c" "src/CMakeFiles/hdf5-shared.dir/H5RQint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5RQint.c.o.d"
+  "/root/repo/src/H5RS.c" "src/CMakeFiles/hdf5-shared.dir/H5RS.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5RS.c.o.d"
+  "/root/repo/src/H5Rdeprec.c" "src/CMakeFiles/hdf5-shared.dir/H5Rdeprec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Rdeprec.c.o.d"
+  "/root/repo/src/H5Rint.c" "src/CMakeFiles/hdf5-shared.dir/H5Rint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Rint.c.o.d"
+  "/root/repo/src/H5S.c" "src/CMakeFiles/hdf5-shared.dir/H5S.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5S.c.o.d"
+  "/root/repo/src/H5SL.c" "src/CMakeFiles/hdf5-shared.dir/H5SL.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5SL.c.o.d"
+  "/root/repo/src/H5SM.c" "src/CMakeFiles/hdf5-shared.dir/H5SM.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5SM.c.o.d"
+  "/root/repo/src/H5SMbtree2.c" "src/CMakeFiles/hdf5-shared.dir/H5SMbtree2.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5SMbtree2.c.o.d"
+  "/root/repo/src/H5SMcache.c" "src/CMakeFiles/hdf5-shared.dir/H5SMcache.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5SMcache.c.o.d"
+  "/root/repo/src/H5SMmessage.c" "src/CMakeFiles/hdf5-shared.dir/H5SMmessage.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5SMmessage.c.o.d"
+  "/root/repo/src/H5SMtest.c" "src/CMakeFiles/hdf5-shared.dir/H5SMtest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5SMtest.c.o.d"
+  "/root/repo/src/H5ST.c" "src/CMakeFiles/hdf5-shared.dir/H5ST.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5ST.c.o.d"
+  "/root/repo/src/H5Sall.c" "src/CMakeFiles/hdf5-shared.dir/H5Sall.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Sall.c.o.d"
+  "/root/repo/src/H5Sdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5Sdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Sdbg.c.o.d"
+  "/root/repo/src/H5Shyper.c" "src/CMakeFiles/hdf5-shared.dir/H5Shyper.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Shyper.c.o.d"
+  "/root/repo/src/H5Smpio.c" "src/CMakeFiles/hdf5-shared.dir/H5Smpio.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Smpio.c.o.d"
+  "/root/repo/src/H5Snone.c" "src/CMakeFiles/hdf5-shared.dir/H5Snone.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Snone.c.o.d"
+  "/root/repo/src/H5Spoint.c" "src/CMakeFiles/hdf5-shared.dir/H5Spoint.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Spoint.c.o.d"
+  "/root/repo/src/H5Sselect.c" "src/CMakeFiles/hdf5-shared.dir/H5Sselect.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Sselect.c.o.d"
+  "/root/repo/src/H5Stest.c" "src/CMakeFiles/hdf5-shared.dir/H5Stest.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Stest.c.o.d"
+  "/root/repo/src/H5T.c" "src/CMakeFiles/hdf5-shared.dir/H5T.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5T.c.o.d"
+  "/root/repo/src/H5TP.c" "src/CMakeFiles/hdf5-shared.dir/H5TP.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5TP.c.o.d"
+  "/root/repo/src/H5TS.c" "src/CMakeFiles/hdf5-shared.dir/H5TS.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5TS.c.o.d"
+  "/root/repo/src/H5Tarray.c" "src/CMakeFiles/hdf5-shared.dir/H5Tarray.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tarray.c.o.d"
+  "/root/repo/src/H5Tbit.c" "src/CMakeFiles/hdf5-shared.dir/H5Tbit.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tbit.c.o.d"
+  "/root/repo/src/H5Tcommit.c" "src/CMakeFiles/hdf5-shared.dir/H5Tcommit.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tcommit.c.o.d"
+  "/root/repo/src/H5Tcompound.c" "src/CMakeFiles/hdf5-shared.dir/H5Tcompound.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tcompound.c.o.d"
+  "/root/repo/src/H5Tconv.c" "src/CMakeFiles/hdf5-shared.dir/H5Tconv.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tconv.c.o.d"
+  "/root/repo/src/H5Tcset.c" "src/CMakeFiles/hdf5-shared.dir/H5Tcset.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tcset.c.o.d"
+  "/root/repo/src/H5Tdbg.c" "src/CMakeFiles/hdf5-shared.dir/H5Tdbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tdbg.c.o.d"
+  "/root/repo/src/H5Tdeprec.c" "src/CMakeFiles/hdf5-shared.dir/H5Tdeprec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tdeprec.c.o.d"
+  "/root/repo/src/H5Tenum.c" "src/CMakeFiles/hdf5-shared.dir/H5Tenum.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tenum.c.o.d"
+  "/root/repo/src/H5Tfields.c" "src/CMakeFiles/hdf5-shared.dir/H5Tfields.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tfields.c.o.d"
+  "/root/repo/src/H5Tfixed.c" "src/CMakeFiles/hdf5-shared.dir/H5Tfixed.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tfixed.c.o.d"
+  "/root/repo/src/H5Tfloat.c" "src/CMakeFiles/hdf5-shared.dir/H5Tfloat.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tfloat.c.o.d"
+  "/root/repo/src/H5Tnative.c" "src/CMakeFiles/hdf5-shared.dir/H5Tnative.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tnative.c.o.d"
+  "/root/repo/src/H5Toffset.c" "src/CMakeFiles/hdf5-shared.dir/H5Toffset.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Toffset.c.o.d"
+  "/root/repo/src/H5Toh.c" "src/CMakeFiles/hdf5-shared.dir/H5Toh.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Toh.c.o.d"
+  "/root/repo/src/H5Topaque.c" "src/CMakeFiles/hdf5-shared.dir/H5Topaque.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Topaque.c.o.d"
+  "/root/repo/src/H5Torder.c" "src/CMakeFiles/hdf5-shared.dir/H5Torder.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Torder.c.o.d"
+  "/root/repo/src/H5Tpad.c" "src/CMakeFiles/hdf5-shared.dir/H5Tpad.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tpad.c.o.d"
+  "/root/repo/src/H5Tprecis.c" "src/CMakeFiles/hdf5-shared.dir/H5Tprecis.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tprecis.c.o.d"
+  "/root/repo/src/H5Tstrpad.c" "src/CMakeFiles/hdf5-shared.dir/H5Tstrpad.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tstrpad.c.o.d"
+  "/root/repo/src/H5Tvec.c" "src/CMakeFiles/hdf5-shared.dir/H5Tvec.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tvec.c.o.d"
+  "/root/repo/src/H5Tvisit.c" "src/CMakeFiles/hdf5-shared.dir/H5Tvisit.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tvisit.c.o.d"
+  "/root/repo/src/H5Tvlen.c" "src/CMakeFiles/hdf5-shared.dir/H5Tvlen.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Tvlen.c.o.d"
+  "/root/repo/src/H5UC.c" "src/CMakeFiles/hdf5-shared.dir/H5UC.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5UC.c.o.d"
+  "/root/repo/src/H5VM.c" "src/CMakeFiles/hdf5-shared.dir/H5VM.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5VM.c.o.d"
+  "/root/repo/src/H5WB.c" "src/CMakeFiles/hdf5-shared.dir/H5WB.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5WB.c.o.d"
+  "/root/repo/src/H5Z.c" "src/CMakeFiles/hdf5-shared.dir/H5Z.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Z.c.o.d"
+  "/root/repo/src/H5Zcrc32c.c" "src/CMakeFiles/hdf5-shared.dir/H5Zcrc32c.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Zcrc32c.c.o.d"
+  "/root/repo/src/H5Zdeflate.c" "src/CMakeFiles/hdf5-shared.dir/H5Zdeflate.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Zdeflate.c.o.d"
+  "/root/repo/src/H5Zfletcher32.c" "src/CMakeFiles/hdf5-shared.dir/H5Zfletcher32.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Zfletcher32.c.o.d"
+  "/root/repo/src/H5Znbit.c" "src/CMakeFiles/hdf5-shared.dir/H5Znbit.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Znbit.c.o.d"
+  "/root/repo/src/H5Zscaleoffset.c" "src/CMakeFiles/hdf5-shared.dir/H5Zscaleoffset.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Zscaleoffset.c.o.d"
+  "/root/repo/src/H5Zshuffle.c" "src/CMakeFiles/hdf5-shared.dir/H5Zshuffle.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Zshuffle.c.o.d"
+  "/root/repo/src/H5Zszip.c" "src/CMakeFiles/hdf5-shared.dir/H5Zszip.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Zszip.c.o.d"
+  "/root/repo/src/H5Ztrans.c" "src/CMakeFiles/hdf5-shared.dir/H5Ztrans.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5Ztrans.c.o.d"
+  "/root/repo/src/H5checksum.c" "src/CMakeFiles/hdf5-shared.dir/H5checksum.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5checksum.c.o.d"
+  "/root/repo/src/H5dbg.c" "src/CMakeFiles/hdf5-shared.dir/H5dbg.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5dbg.c.o.d"
+  "/root/repo/src/H5system.c" "src/CMakeFiles/hdf5-shared.dir/H5system.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5system.c.o.d"
+  "/root/repo/src/H5timer.c" "src/CMakeFiles/hdf5-shared.dir/H5timer.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5timer.c.o.d"
+  "/root/repo/src/H5trace.c" "src/CMakeFiles/hdf5-shared.dir/H5trace.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/H5trace.c.o.d"
+  "/root/repo/_par_build/shared/H5Tinit.c" "src/CMakeFiles/hdf5-shared.dir/__/shared/H5Tinit.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/__/shared/H5Tinit.c.o.d"
+  "/root/repo/_par_build/shared/H5lib_settings.c" "src/CMakeFiles/hdf5-shared.dir/__/shared/H5lib_settings.c.o" "gcc" "src/CMakeFiles/hdf5-shared.dir/__/shared/H5lib_settings.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_par_build/bin/libhdf5.so" "/root/repo/_par_build/bin/libhdf5.so.1.11.0"
+  "/root/repo/_par_build/bin/libhdf5.so.1000.0.0" "/root/repo/_par_build/bin/libhdf5.so.1.11.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,175 @@
+# Install script for directory: /root/repo/src
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local/HDF_Group/HDF5/1.11.0")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include" TYPE FILE FILES
+    "/root/repo/src/hdf5.h"
+    "/root/repo/src/H5api_adpt.h"
+    "/root/repo/src/H5public.h"
+    "/root/repo/src/H5Apkg.h"
+    "/root/repo/src/H5Apublic.h"
+    "/root/repo/src/H5ACpkg.h"
+    "/root/repo/src/H5ACpublic.h"
+    "/root/repo/src/H5Bpkg.h"
+    "/root/repo/src/H5Bpublic.h"
+    "/root/repo/src/H5B2pkg.h"
+    "/root/repo/src/H5B2public.h"
+    "/root/repo/src/H5Cpkg.h"
+    "/root/repo/src/H5Cpublic.h"
+    "/root/repo/src/H5Dpkg.h"
+    "/root/repo/src/H5Dpublic.h"
+    "/root/repo/src/H5Epkg.h"
+    "/root/repo/src/H5Epublic.h"
+    "/root/repo/src/H5EApkg.h"
+    "/root/repo/src/H5Fpkg.h"
+    "/root/repo/src/H5Fpublic.h"
+    "/root/repo/src/H5FApkg.h"
+    "/root/repo/src/H5FDcore.h"
+    "/root/repo/src/H5FDdirect.h"
+    "/root/repo/src/H5FDfamily.h"
+    "/root/repo/src/H5FDlog.h"
+    "/root/repo/src/H5FDmmap.h"
+    "/root/repo/src/H5FDmpi.h"
+    "/root/repo/src/H5FDmpio.h"
+    "/root/repo/src/H5FDmulti.h"
+    "/root/repo/src/H5FDpkg.h"
+    "/root/repo/src/H5FDpublic.h"
+    "/root/repo/src/H5FDsec2.h"
+    "/root/repo/src/H5FDstdio.h"
+    "/root/repo/src/H5FDuring.h"
+    "/root/repo/src/H5FDwindows.h"
+    "/root/repo/src/H5FSpkg.h"
+    "/root/repo/src/H5FSpublic.h"
+    "/root/repo/src/H5Gpkg.h"
+    "/root/repo/src/H5Gpublic.h"
+    "/root/repo/src/H5HFpkg.h"
+    "/root/repo/src/H5HFpublic.h"
+    "/root/repo/src/H5HGpkg.h"
+    "/root/repo/src/H5HGpublic.h"
+    "/root/repo/src/H5HLpkg.h"
+    "/root/repo/src/H5HLpublic.h"
+    "/root/repo/src/H5Ipkg.h"
+    "/root/repo/src/H5Ipublic.h"
+    "/root/repo/src/H5Lpkg.h"
+    "/root/repo/src/H5Lpublic.h"
+    "/root/repo/src/H5MMpublic.h"
+    "/root/repo/src/H5MPpkg.h"
+    "/root/repo/src/H5Opkg.h"
+    "/root/repo/src/H5Opublic.h"
+    "/root/repo/src/H5Oshared.h"
+    "/root/repo/src/H5Ppkg.h"
+    "/root/repo/src/H5Ppublic.h"
+    "/root/repo/src/H5PBpkg.h"
+    "/root/repo/src/H5PLextern.h"
+    "/root/repo/src/H5PLpkg.h"
+    "/root/repo/src/H5PLpublic.h"
+    "/root/repo/src/H5Rpkg.h"
+    "/root/repo/src/H5Rpublic.h"
+    "/root/repo/src/H5RQpkg.h"
+    "/root/repo/src/H5RQpublic.h"
+    "/root/repo/src/H5Spkg.h"
+    "/root/repo/src/H5Spublic.h"
+    "/root/repo/src/H5SMpkg.h"
+    "/root/repo/src/H5Tpkg.h"
+    "/root/repo/src/H5Tpublic.h"
+    "/root/repo/src/H5Zpkg.h"
+    "/root/repo/src/H5Zpublic.h"
+    "/root/repo/src/H5Edefin.h"
+    "/root/repo/src/H5Einit.h"
+    "/root/repo/src/H5Epubgen.h"
+    "/root/repo/src/H5Eterm.h"
+    "/root/repo/src/H5version.h"
+    "/root/repo/src/H5overflow.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_par_build/bin/libhdf5.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so.1.11.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so.1000.0.0"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_par_build/bin/libhdf5.so.1.11.0"
+    "/root/repo/_par_build/bin/libhdf5.so.1000.0.0"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so.1.11.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so.1000.0.0"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_par_build/bin/libhdf5.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libhdf5.so")
+    endif()
+  endif()
+endif()
+
@@ -0,0 +1,159 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HDF5_TEST_LIBSH_files"
+  "H5TEST-shared/aggr.h5"
+  "H5TEST-shared/bad_compound.h5"
+  "H5TEST-shared/bad_offset.h5"
+  "H5TEST-shared/be_data.h5"
+  "H5TEST-shared/be_extlink1.h5"
+  "H5TEST-shared/be_extlink2.h5"
+  "H5TEST-shared/btree_idx_1_6.h5"
+  "H5TEST-shared/btree_idx_1_8.h5"
+  "H5TEST-shared/corrupt_stab_msg.h5"
+  "H5TEST-shared/deflate.h5"
+  "H5TEST-shared/err_compat_1"
+  "H5TEST-shared/err_compat_2"
+  "H5TEST-shared/error_test_1"
+  "H5TEST-shared/error_test_2"
+  "H5TEST-shared/family_v16_00000.h5"
+  "H5TEST-shared/family_v16_00001.h5"
+  "H5TEST-shared/family_v16_00002.h5"
+  "H5TEST-shared/family_v16_00003.h5"
+  "H5TEST-shared/file_image_core_test.h5"
+  "H5TEST-shared/filespace_1_6.h5"
+  "H5TEST-shared/filespace_1_8.h5"
+  "H5TEST-shared/fill_old.h5"
+  "H5TEST-shared/filter_error.h5"
+  "H5TEST-shared/fsm_aggr_nopersist.h5"
+  "H5TEST-shared/fsm_aggr_persist.h5"
+  "H5TEST-shared/group_old.h5"
+  "H5TEST-shared/h5fc_ext1_f.h5"
+  "H5TEST-shared/h5fc_ext1_i.h5"
+  "H5TEST-shared/h5fc_ext2_if.h5"
+  "H5TEST-shared/h5fc_ext2_sf.h5"
+  "H5TEST-shared/h5fc_ext3_isf.h5"
+  "H5TEST-shared/h5fc_ext_none.h5"
+  "H5TEST-shared/le_data.h5"
+  "H5TEST-shared/le_extlink1.h5"
+  "H5TEST-shared/le_extlink2.h5"
+  "H5TEST-shared/links_env.out"
+  "H5TEST-shared/mergemsg.h5"
+  "H5TEST-shared/multi_file_v16-r.h5"
+  "H5TEST-shared/multi_file_v16-s.h5"
+  "H5TEST-shared/noencoder.h5"
+  "H5TEST-shared/none.h5"
+  "H5TEST-shared/paged_nopersist.h5"
+  "H5TEST-shared/paged_persist.h5"
+  "H5TEST-shared/specmetaread.h5"
+  "H5TEST-shared/tarrold.h5"
+  "H5TEST-shared/tbad_msg_count.h5"
+  "H5TEST-shared/tbogus.h5"
+  "H5TEST-shared/test_filters_be.h5"
+  "H5TEST-shared/test_filters_le.h5"
+  "H5TEST-shared/testfiles/plist_files/acpl_32be"
+  "H5TEST-shared/testfiles/plist_files/acpl_32le"
+  "H5TEST-shared/testfiles/plist_files/acpl_64be"
+  "H5TEST-shared/testfiles/plist_files/acpl_64le"
+  "H5TEST-shared/testfiles/plist_files/dapl_32be"
+  "H5TEST-shared/testfiles/plist_files/dapl_32le"
+  "H5TEST-shared/testfiles/plist_files/dapl_64be"
+  "H5TEST-shared/testfiles/plist_files/dapl_64le"
+  "H5TEST-shared/testfiles/plist_files/dcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/dcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/dcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/dcpl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_acpl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_acpl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_acpl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_acpl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_dapl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_dapl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_dapl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_dapl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_dcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_dcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_dcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_dcpl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_dxpl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_dxpl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_dxpl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_dxpl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_fapl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_fapl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_fapl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_fapl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_fcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_fcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_fcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_fcpl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_gcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_gcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_gcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_gcpl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_lapl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_lapl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_lapl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_lapl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_lcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_lcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_lcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_lcpl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_ocpl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_ocpl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_ocpl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_ocpl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_ocpypl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_ocpypl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_ocpypl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_ocpypl_64le"
+  "H5TEST-shared/testfiles/plist_files/def_strcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/def_strcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/def_strcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/def_strcpl_64le"
+  "H5TEST-shared/testfiles/plist_files/dxpl_32be"
+  "H5TEST-shared/testfiles/plist_files/dxpl_32le"
+  "H5TEST-shared/testfiles/plist_files/dxpl_64be"
+  "H5TEST-shared/testfiles/plist_files/dxpl_64le"
+  "H5TEST-shared/testfiles/plist_files/fapl_32be"
+  "H5TEST-shared/testfiles/plist_files/fapl_32le"
+  "H5TEST-shared/testfiles/plist_files/fapl_64be"
+  "H5TEST-shared/testfiles/plist_files/fapl_64le"
+  "H5TEST-shared/testfiles/plist_files/fcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/fcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/fcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/fcpl_64le"
+  "H5TEST-shared/testfiles/plist_files/gcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/gcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/gcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/gcpl_64le"
+  "H5TEST-shared/testfiles/plist_files/lapl_32be"
+  "H5TEST-shared/testfiles/plist_files/lapl_32le"
+  "H5TEST-shared/testfiles/plist_files/lapl_64be"
+  "H5TEST-shared/testfiles/plist_files/lapl_64le"
+  "H5TEST-shared/testfiles/plist_files/lcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/lcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/lcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/lcpl_64le"
+  "H5TEST-shared/testfiles/plist_files/ocpl_32be"
+  "H5TEST-shared/testfiles/plist_files/ocpl_32le"
+  "H5TEST-shared/testfiles/plist_files/ocpl_64be"
+  "H5TEST-shared/testfiles/plist_files/ocpl_64le"
+  "H5TEST-shared/testfiles/plist_files/ocpypl_32be"
+  "H5TEST-shared/testfiles/plist_files/ocpypl_32le"
+  "H5TEST-shared/testfiles/plist_files/ocpypl_64be"
+  "H5TEST-shared/testfiles/plist_files/ocpypl_64le"
+  "H5TEST-shared/testfiles/plist_files/strcpl_32be"
+  "H5TEST-shared/testfiles/plist_files/strcpl_32le"
+  "H5TEST-shared/testfiles/plist_files/strcpl_64be"
+  "H5TEST-shared/testfiles/plist_files/strcpl_64le"
+  "H5TEST-shared/th5s.h5"
+  "H5TEST-shared/tlayouto.h5"
+  "H5TEST-shared/tmtimen.h5"
+  "H5TEST-shared/tmtimeo.h5"
+  "H5TEST-shared/tnullspace.h5"
+  "H5TEST-shared/tsizeslheap.h5"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/HDF5_TEST_LIBSH_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/accum-shared"
+  "../bin/accum-shared.pdb"
+  "CMakeFiles/accum-shared.dir/accum.c.o"
+  "CMakeFiles/accum-shared.dir/accum.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/accum-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
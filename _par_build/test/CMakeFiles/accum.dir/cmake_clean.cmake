@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/accum"
+  "../bin/accum.pdb"
+  "CMakeFiles/accum.dir/accum.c.o"
+  "CMakeFiles/accum.dir/accum.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/accum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/accum_swmr_reader.c" "test/CMakeFiles/accum_swmr_reader.dir/accum_swmr_reader.c.o" "gcc" "test/CMakeFiles/accum_swmr_reader.dir/accum_swmr_reader.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_par_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  "/root/repo/_par_build/test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
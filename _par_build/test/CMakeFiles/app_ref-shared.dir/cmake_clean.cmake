@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/app_ref-shared"
+  "../bin/app_ref-shared.pdb"
+  "CMakeFiles/app_ref-shared.dir/app_ref.c.o"
+  "CMakeFiles/app_ref-shared.dir/app_ref.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/app_ref-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
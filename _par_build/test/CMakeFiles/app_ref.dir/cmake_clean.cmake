@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/app_ref"
+  "../bin/app_ref.pdb"
+  "CMakeFiles/app_ref.dir/app_ref.c.o"
+  "CMakeFiles/app_ref.dir/app_ref.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/app_ref.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/atomic_reader-shared"
+  "../bin/atomic_reader-shared.pdb"
+  "CMakeFiles/atomic_reader-shared.dir/atomic_reader.c.o"
+  "CMakeFiles/atomic_reader-shared.dir/atomic_reader.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/atomic_reader-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/atomic_reader"
+  "../bin/atomic_reader.pdb"
+  "CMakeFiles/atomic_reader.dir/atomic_reader.c.o"
+  "CMakeFiles/atomic_reader.dir/atomic_reader.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/atomic_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
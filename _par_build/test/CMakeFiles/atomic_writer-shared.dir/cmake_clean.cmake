@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/atomic_writer-shared"
+  "../bin/atomic_writer-shared.pdb"
+  "CMakeFiles/atomic_writer-shared.dir/atomic_writer.c.o"
+  "CMakeFiles/atomic_writer-shared.dir/atomic_writer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/atomic_writer-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/atomic_writer"
+  "../bin/atomic_writer.pdb"
+  "CMakeFiles/atomic_writer.dir/atomic_writer.c.o"
+  "CMakeFiles/atomic_writer.dir/atomic_writer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/atomic_writer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
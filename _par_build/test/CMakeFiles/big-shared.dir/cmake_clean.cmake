@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/big-shared"
+  "../bin/big-shared.pdb"
+  "CMakeFiles/big-shared.dir/big.c.o"
+  "CMakeFiles/big-shared.dir/big.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/big-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/big"
+  "../bin/big.pdb"
+  "CMakeFiles/big.dir/big.c.o"
+  "CMakeFiles/big.dir/big.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/big.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
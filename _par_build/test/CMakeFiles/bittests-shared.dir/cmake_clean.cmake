@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/bittests-shared"
+  "../bin/bittests-shared.pdb"
+  "CMakeFiles/bittests-shared.dir/bittests.c.o"
+  "CMakeFiles/bittests-shared.dir/bittests.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bittests-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
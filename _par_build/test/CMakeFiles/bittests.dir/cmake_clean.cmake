@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/bittests"
+  "../bin/bittests.pdb"
+  "CMakeFiles/bittests.dir/bittests.c.o"
+  "CMakeFiles/bittests.dir/bittests.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bittests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/btree2-shared"
+  "../bin/btree2-shared.pdb"
+  "CMakeFiles/btree2-shared.dir/btree2.c.o"
+  "CMakeFiles/btree2-shared.dir/btree2.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/btree2-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/btree2"
+  "../bin/btree2.pdb"
+  "CMakeFiles/btree2.dir/btree2.c.o"
+  "CMakeFiles/btree2.dir/btree2.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/btree2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cache-shared"
+  "../bin/cache-shared.pdb"
+  "CMakeFiles/cache-shared.dir/cache.c.o"
+  "CMakeFiles/cache-shared.dir/cache.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cache-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
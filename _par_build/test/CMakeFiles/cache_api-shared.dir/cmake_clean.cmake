@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cache_api-shared"
+  "../bin/cache_api-shared.pdb"
+  "CMakeFiles/cache_api-shared.dir/cache_api.c.o"
+  "CMakeFiles/cache_api-shared.dir/cache_api.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cache_api-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/cache_image-shared"
+  "../bin/cache_image-shared.pdb"
+  "CMakeFiles/cache_image-shared.dir/cache_image.c.o"
+  "CMakeFiles/cache_image-shared.dir/cache_image.c.o.d"
+  "CMakeFiles/cache_image-shared.dir/genall5.c.o"
+  "CMakeFiles/cache_image-shared.dir/genall5.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cache_image-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
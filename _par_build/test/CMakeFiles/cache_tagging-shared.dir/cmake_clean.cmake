@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cache_tagging-shared"
+  "../bin/cache_tagging-shared.pdb"
+  "CMakeFiles/cache_tagging-shared.dir/cache_tagging.c.o"
+  "CMakeFiles/cache_tagging-shared.dir/cache_tagging.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cache_tagging-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cache_tagging"
+  "../bin/cache_tagging.pdb"
+  "CMakeFiles/cache_tagging.dir/cache_tagging.c.o"
+  "CMakeFiles/cache_tagging.dir/cache_tagging.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cache_tagging.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
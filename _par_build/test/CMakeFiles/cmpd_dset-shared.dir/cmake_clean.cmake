@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cmpd_dset-shared"
+  "../bin/cmpd_dset-shared.pdb"
+  "CMakeFiles/cmpd_dset-shared.dir/cmpd_dset.c.o"
+  "CMakeFiles/cmpd_dset-shared.dir/cmpd_dset.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmpd_dset-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
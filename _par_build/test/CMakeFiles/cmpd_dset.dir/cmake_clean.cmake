@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cmpd_dset"
+  "../bin/cmpd_dset.pdb"
+  "CMakeFiles/cmpd_dset.dir/cmpd_dset.c.o"
+  "CMakeFiles/cmpd_dset.dir/cmpd_dset.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmpd_dset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cork-shared"
+  "../bin/cork-shared.pdb"
+  "CMakeFiles/cork-shared.dir/cork.c.o"
+  "CMakeFiles/cork-shared.dir/cork.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cork-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
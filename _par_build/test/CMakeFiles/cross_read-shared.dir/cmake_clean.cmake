@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cross_read-shared"
+  "../bin/cross_read-shared.pdb"
+  "CMakeFiles/cross_read-shared.dir/cross_read.c.o"
+  "CMakeFiles/cross_read-shared.dir/cross_read.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cross_read-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cross_read"
+  "../bin/cross_read.pdb"
+  "CMakeFiles/cross_read.dir/cross_read.c.o"
+  "CMakeFiles/cross_read.dir/cross_read.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cross_read.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dangle-shared"
+  "../bin/dangle-shared.pdb"
+  "CMakeFiles/dangle-shared.dir/dangle.c.o"
+  "CMakeFiles/dangle-shared.dir/dangle.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dangle-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dsets-shared"
+  "../bin/dsets-shared.pdb"
+  "CMakeFiles/dsets-shared.dir/dsets.c.o"
+  "CMakeFiles/dsets-shared.dir/dsets.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dsets-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dsets"
+  "../bin/dsets.pdb"
+  "CMakeFiles/dsets.dir/dsets.c.o"
+  "CMakeFiles/dsets.dir/dsets.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dsets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dt_arith-shared"
+  "../bin/dt_arith-shared.pdb"
+  "CMakeFiles/dt_arith-shared.dir/dt_arith.c.o"
+  "CMakeFiles/dt_arith-shared.dir/dt_arith.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dt_arith-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dt_arith"
+  "../bin/dt_arith.pdb"
+  "CMakeFiles/dt_arith.dir/dt_arith.c.o"
+  "CMakeFiles/dt_arith.dir/dt_arith.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dt_arith.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
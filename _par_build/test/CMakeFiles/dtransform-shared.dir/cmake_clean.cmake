@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dtransform-shared"
+  "../bin/dtransform-shared.pdb"
+  "CMakeFiles/dtransform-shared.dir/dtransform.c.o"
+  "CMakeFiles/dtransform-shared.dir/dtransform.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtransform-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dtransform"
+  "../bin/dtransform.pdb"
+  "CMakeFiles/dtransform.dir/dtransform.c.o"
+  "CMakeFiles/dtransform.dir/dtransform.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtransform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dtypes-shared"
+  "../bin/dtypes-shared.pdb"
+  "CMakeFiles/dtypes-shared.dir/dtypes.c.o"
+  "CMakeFiles/dtypes-shared.dir/dtypes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtypes-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
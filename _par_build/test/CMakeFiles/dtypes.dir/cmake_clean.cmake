@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/dtypes"
+  "../bin/dtypes.pdb"
+  "CMakeFiles/dtypes.dir/dtypes.c.o"
+  "CMakeFiles/dtypes.dir/dtypes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtypes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/earray-shared"
+  "../bin/earray-shared.pdb"
+  "CMakeFiles/earray-shared.dir/earray.c.o"
+  "CMakeFiles/earray-shared.dir/earray.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/earray-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
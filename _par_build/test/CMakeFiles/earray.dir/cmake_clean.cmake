@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/earray"
+  "../bin/earray.pdb"
+  "CMakeFiles/earray.dir/earray.c.o"
+  "CMakeFiles/earray.dir/earray.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/earray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
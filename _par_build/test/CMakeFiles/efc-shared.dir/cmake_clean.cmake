@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/efc-shared"
+  "../bin/efc-shared.pdb"
+  "CMakeFiles/efc-shared.dir/efc.c.o"
+  "CMakeFiles/efc-shared.dir/efc.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/efc-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/efc"
+  "../bin/efc.pdb"
+  "CMakeFiles/efc.dir/efc.c.o"
+  "CMakeFiles/efc.dir/efc.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/efc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
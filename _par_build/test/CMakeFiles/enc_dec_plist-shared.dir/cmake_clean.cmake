@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/enc_dec_plist-shared"
+  "../bin/enc_dec_plist-shared.pdb"
+  "CMakeFiles/enc_dec_plist-shared.dir/enc_dec_plist.c.o"
+  "CMakeFiles/enc_dec_plist-shared.dir/enc_dec_plist.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/enc_dec_plist-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/enc_dec_plist"
+  "../bin/enc_dec_plist.pdb"
+  "CMakeFiles/enc_dec_plist.dir/enc_dec_plist.c.o"
+  "CMakeFiles/enc_dec_plist.dir/enc_dec_plist.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/enc_dec_plist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/enc_dec_plist_cross_platform-shared"
+  "../bin/enc_dec_plist_cross_platform-shared.pdb"
+  "CMakeFiles/enc_dec_plist_cross_platform-shared.dir/enc_dec_plist_cross_platform.c.o"
+  "CMakeFiles/enc_dec_plist_cross_platform-shared.dir/enc_dec_plist_cross_platform.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/enc_dec_plist_cross_platform-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
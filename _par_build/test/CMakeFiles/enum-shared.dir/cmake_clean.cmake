@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/enum-shared"
+  "../bin/enum-shared.pdb"
+  "CMakeFiles/enum-shared.dir/enum.c.o"
+  "CMakeFiles/enum-shared.dir/enum.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/enum-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/err_compat-shared"
+  "../bin/err_compat-shared.pdb"
+  "CMakeFiles/err_compat-shared.dir/err_compat.c.o"
+  "CMakeFiles/err_compat-shared.dir/err_compat.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/err_compat-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/err_compat"
+  "../bin/err_compat.pdb"
+  "CMakeFiles/err_compat.dir/err_compat.c.o"
+  "CMakeFiles/err_compat.dir/err_compat.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/err_compat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
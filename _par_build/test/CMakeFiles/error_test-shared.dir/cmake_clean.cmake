@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/error_test-shared"
+  "../bin/error_test-shared.pdb"
+  "CMakeFiles/error_test-shared.dir/error_test.c.o"
+  "CMakeFiles/error_test-shared.dir/error_test.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/error_test-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
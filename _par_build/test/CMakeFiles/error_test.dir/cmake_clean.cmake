@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/error_test"
+  "../bin/error_test.pdb"
+  "CMakeFiles/error_test.dir/error_test.c.o"
+  "CMakeFiles/error_test.dir/error_test.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/error_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/evict_on_close-shared"
+  "../bin/evict_on_close-shared.pdb"
+  "CMakeFiles/evict_on_close-shared.dir/evict_on_close.c.o"
+  "CMakeFiles/evict_on_close-shared.dir/evict_on_close.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/evict_on_close-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/extend-shared"
+  "../bin/extend-shared.pdb"
+  "CMakeFiles/extend-shared.dir/extend.c.o"
+  "CMakeFiles/extend-shared.dir/extend.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/extend-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
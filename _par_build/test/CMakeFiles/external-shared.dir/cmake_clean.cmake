@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/external-shared"
+  "../bin/external-shared.pdb"
+  "CMakeFiles/external-shared.dir/external.c.o"
+  "CMakeFiles/external-shared.dir/external.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/external-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
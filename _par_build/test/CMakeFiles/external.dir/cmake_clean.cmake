@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/external"
+  "../bin/external.pdb"
+  "CMakeFiles/external.dir/external.c.o"
+  "CMakeFiles/external.dir/external.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/external.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/farray-shared"
+  "../bin/farray-shared.pdb"
+  "CMakeFiles/farray-shared.dir/farray.c.o"
+  "CMakeFiles/farray-shared.dir/farray.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/farray-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/farray"
+  "../bin/farray.pdb"
+  "CMakeFiles/farray.dir/farray.c.o"
+  "CMakeFiles/farray.dir/farray.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/farray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
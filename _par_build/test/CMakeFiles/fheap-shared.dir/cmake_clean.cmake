@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/fheap-shared"
+  "../bin/fheap-shared.pdb"
+  "CMakeFiles/fheap-shared.dir/fheap.c.o"
+  "CMakeFiles/fheap-shared.dir/fheap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/fheap-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/filenotclosed-shared"
+  "../bin/filenotclosed-shared.pdb"
+  "CMakeFiles/filenotclosed-shared.dir/filenotclosed.c.o"
+  "CMakeFiles/filenotclosed-shared.dir/filenotclosed.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filenotclosed-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
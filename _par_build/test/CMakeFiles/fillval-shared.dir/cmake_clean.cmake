@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/fillval-shared"
+  "../bin/fillval-shared.pdb"
+  "CMakeFiles/fillval-shared.dir/fillval.c.o"
+  "CMakeFiles/fillval-shared.dir/fillval.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/fillval-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/fillval"
+  "../bin/fillval.pdb"
+  "CMakeFiles/fillval.dir/fillval.c.o"
+  "CMakeFiles/fillval.dir/fillval.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/fillval.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
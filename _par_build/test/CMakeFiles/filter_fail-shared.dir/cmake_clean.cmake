@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/filter_fail-shared"
+  "../bin/filter_fail-shared.pdb"
+  "CMakeFiles/filter_fail-shared.dir/filter_fail.c.o"
+  "CMakeFiles/filter_fail-shared.dir/filter_fail.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filter_fail-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
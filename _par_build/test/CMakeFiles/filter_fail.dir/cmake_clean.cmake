@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/filter_fail"
+  "../bin/filter_fail.pdb"
+  "CMakeFiles/filter_fail.dir/filter_fail.c.o"
+  "CMakeFiles/filter_fail.dir/filter_fail.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filter_fail.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/filter_plugin"
+  "../bin/filter_plugin.pdb"
+  "CMakeFiles/filter_plugin.dir/filter_plugin.c.o"
+  "CMakeFiles/filter_plugin.dir/filter_plugin.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filter_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
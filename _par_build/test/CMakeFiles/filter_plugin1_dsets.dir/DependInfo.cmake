@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/filter_plugin1_dsets.c" "test/CMakeFiles/filter_plugin1_dsets.dir/filter_plugin1_dsets.c.o" "gcc" "test/CMakeFiles/filter_plugin1_dsets.dir/filter_plugin1_dsets.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_par_build/bin/libfilter_plugin1_dsets.so" "/root/repo/_par_build/bin/libfilter_plugin1_dsets.so.1.11.0"
+  "/root/repo/_par_build/bin/libfilter_plugin1_dsets.so.1000.0.0" "/root/repo/_par_build/bin/libfilter_plugin1_dsets.so.1.11.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_par_build/test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  "/root/repo/_par_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
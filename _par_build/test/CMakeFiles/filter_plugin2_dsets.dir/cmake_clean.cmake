@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/libfilter_plugin2_dsets.pdb"
+  "../bin/libfilter_plugin2_dsets.so"
+  "../bin/libfilter_plugin2_dsets.so.1.11.0"
+  "../bin/libfilter_plugin2_dsets.so.1000.0.0"
+  "CMakeFiles/filter_plugin2_dsets.dir/filter_plugin2_dsets.c.o"
+  "CMakeFiles/filter_plugin2_dsets.dir/filter_plugin2_dsets.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filter_plugin2_dsets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
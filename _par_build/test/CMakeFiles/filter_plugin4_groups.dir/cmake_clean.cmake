@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/libfilter_plugin4_groups.pdb"
+  "../bin/libfilter_plugin4_groups.so"
+  "../bin/libfilter_plugin4_groups.so.1.11.0"
+  "../bin/libfilter_plugin4_groups.so.1000.0.0"
+  "CMakeFiles/filter_plugin4_groups.dir/filter_plugin4_groups.c.o"
+  "CMakeFiles/filter_plugin4_groups.dir/filter_plugin4_groups.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filter_plugin4_groups.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
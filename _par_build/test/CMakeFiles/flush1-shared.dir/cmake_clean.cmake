@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/flush1-shared"
+  "../bin/flush1-shared.pdb"
+  "CMakeFiles/flush1-shared.dir/flush1.c.o"
+  "CMakeFiles/flush1-shared.dir/flush1.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/flush1-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/flush2-shared"
+  "../bin/flush2-shared.pdb"
+  "CMakeFiles/flush2-shared.dir/flush2.c.o"
+  "CMakeFiles/flush2-shared.dir/flush2.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/flush2-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/flushrefresh-shared"
+  "../bin/flushrefresh-shared.pdb"
+  "CMakeFiles/flushrefresh-shared.dir/flushrefresh.c.o"
+  "CMakeFiles/flushrefresh-shared.dir/flushrefresh.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/flushrefresh-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/freespace-shared"
+  "../bin/freespace-shared.pdb"
+  "CMakeFiles/freespace-shared.dir/freespace.c.o"
+  "CMakeFiles/freespace-shared.dir/freespace.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/freespace-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
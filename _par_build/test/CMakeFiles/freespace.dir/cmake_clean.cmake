@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/freespace"
+  "../bin/freespace.pdb"
+  "CMakeFiles/freespace.dir/freespace.c.o"
+  "CMakeFiles/freespace.dir/freespace.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/freespace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/getname-shared"
+  "../bin/getname-shared.pdb"
+  "CMakeFiles/getname-shared.dir/getname.c.o"
+  "CMakeFiles/getname-shared.dir/getname.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/getname-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
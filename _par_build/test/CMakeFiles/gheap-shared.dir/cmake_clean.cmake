@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/gheap-shared"
+  "../bin/gheap-shared.pdb"
+  "CMakeFiles/gheap-shared.dir/gheap.c.o"
+  "CMakeFiles/gheap-shared.dir/gheap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gheap-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
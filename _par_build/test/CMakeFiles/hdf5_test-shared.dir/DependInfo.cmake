@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/cache_common.c" "test/CMakeFiles/hdf5_test-shared.dir/cache_common.c.o" "gcc" "test/CMakeFiles/hdf5_test-shared.dir/cache_common.c.o.d"
+  "/root/repo/test/h5test.c" "test/CMakeFiles/hdf5_test-shared.dir/h5test.c.o" "gcc" "test/CMakeFiles/hdf5_test-shared.dir/h5test.c.o.d"
+  "/root/repo/test/swmr_common.c" "test/CMakeFiles/hdf5_test-shared.dir/swmr_common.c.o" "gcc" "test/CMakeFiles/hdf5_test-shared.dir/swmr_common.c.o.d"
+  "/root/repo/test/testframe.c" "test/CMakeFiles/hdf5_test-shared.dir/testframe.c.o" "gcc" "test/CMakeFiles/hdf5_test-shared.dir/testframe.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_par_build/bin/libhdf5_test.so" "/root/repo/_par_build/bin/libhdf5_test.so.1.11.0"
+  "/root/repo/_par_build/bin/libhdf5_test.so.1000.0.0" "/root/repo/_par_build/bin/libhdf5_test.so.1.11.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_par_build/src/CMakeFiles/hdf5-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../bin/libhdf5_test.pdb"
+  "../bin/libhdf5_test.so"
+  "../bin/libhdf5_test.so.1.11.0"
+  "../bin/libhdf5_test.so.1000.0.0"
+  "CMakeFiles/hdf5_test-shared.dir/cache_common.c.o"
+  "CMakeFiles/hdf5_test-shared.dir/cache_common.c.o.d"
+  "CMakeFiles/hdf5_test-shared.dir/h5test.c.o"
+  "CMakeFiles/hdf5_test-shared.dir/h5test.c.o.d"
+  "CMakeFiles/hdf5_test-shared.dir/swmr_common.c.o"
+  "CMakeFiles/hdf5_test-shared.dir/swmr_common.c.o.d"
+  "CMakeFiles/hdf5_test-shared.dir/testframe.c.o"
+  "CMakeFiles/hdf5_test-shared.dir/testframe.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf5_test-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
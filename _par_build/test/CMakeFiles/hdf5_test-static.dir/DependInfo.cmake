@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/cache_common.c" "test/CMakeFiles/hdf5_test-static.dir/cache_common.c.o" "gcc" "test/CMakeFiles/hdf5_test-static.dir/cache_common.c.o.d"
+  "/root/repo/test/h5test.c" "test/CMakeFiles/hdf5_test-static.dir/h5test.c.o" "gcc" "test/CMakeFiles/hdf5_test-static.dir/h5test.c.o.d"
+  "/root/repo/test/swmr_common.c" "test/CMakeFiles/hdf5_test-static.dir/swmr_common.c.o" "gcc" "test/CMakeFiles/hdf5_test-static.dir/swmr_common.c.o.d"
+  "/root/repo/test/testframe.c" "test/CMakeFiles/hdf5_test-static.dir/testframe.c.o" "gcc" "test/CMakeFiles/hdf5_test-static.dir/testframe.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_par_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/hyperslab-shared"
+  "../bin/hyperslab-shared.pdb"
+  "CMakeFiles/hyperslab-shared.dir/hyperslab.c.o"
+  "CMakeFiles/hyperslab-shared.dir/hyperslab.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hyperslab-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/istore-shared"
+  "../bin/istore-shared.pdb"
+  "CMakeFiles/istore-shared.dir/istore.c.o"
+  "CMakeFiles/istore-shared.dir/istore.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/istore-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
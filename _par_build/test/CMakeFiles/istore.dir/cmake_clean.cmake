@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/istore"
+  "../bin/istore.pdb"
+  "CMakeFiles/istore.dir/istore.c.o"
+  "CMakeFiles/istore.dir/istore.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/istore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
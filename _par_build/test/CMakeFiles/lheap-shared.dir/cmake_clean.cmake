@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/lheap-shared"
+  "../bin/lheap-shared.pdb"
+  "CMakeFiles/lheap-shared.dir/lheap.c.o"
+  "CMakeFiles/lheap-shared.dir/lheap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lheap-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/links-shared"
+  "../bin/links-shared.pdb"
+  "CMakeFiles/links-shared.dir/links.c.o"
+  "CMakeFiles/links-shared.dir/links.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/links-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/links_env-shared"
+  "../bin/links_env-shared.pdb"
+  "CMakeFiles/links_env-shared.dir/links_env.c.o"
+  "CMakeFiles/links_env-shared.dir/links_env.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/links_env-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
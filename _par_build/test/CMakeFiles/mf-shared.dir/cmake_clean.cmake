@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/mf-shared"
+  "../bin/mf-shared.pdb"
+  "CMakeFiles/mf-shared.dir/mf.c.o"
+  "CMakeFiles/mf-shared.dir/mf.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mf-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/mount-shared"
+  "../bin/mount-shared.pdb"
+  "CMakeFiles/mount-shared.dir/mount.c.o"
+  "CMakeFiles/mount-shared.dir/mount.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mount-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/mtime-shared"
+  "../bin/mtime-shared.pdb"
+  "CMakeFiles/mtime-shared.dir/mtime.c.o"
+  "CMakeFiles/mtime-shared.dir/mtime.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mtime-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
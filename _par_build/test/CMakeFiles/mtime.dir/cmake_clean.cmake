@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/mtime"
+  "../bin/mtime.pdb"
+  "CMakeFiles/mtime.dir/mtime.c.o"
+  "CMakeFiles/mtime.dir/mtime.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mtime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
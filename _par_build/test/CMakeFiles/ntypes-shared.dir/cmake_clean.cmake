@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/ntypes-shared"
+  "../bin/ntypes-shared.pdb"
+  "CMakeFiles/ntypes-shared.dir/ntypes.c.o"
+  "CMakeFiles/ntypes-shared.dir/ntypes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ntypes-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/objcopy-shared"
+  "../bin/objcopy-shared.pdb"
+  "CMakeFiles/objcopy-shared.dir/objcopy.c.o"
+  "CMakeFiles/objcopy-shared.dir/objcopy.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/objcopy-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/objcopy"
+  "../bin/objcopy.pdb"
+  "CMakeFiles/objcopy.dir/objcopy.c.o"
+  "CMakeFiles/objcopy.dir/objcopy.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/objcopy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/ohdr-shared"
+  "../bin/ohdr-shared.pdb"
+  "CMakeFiles/ohdr-shared.dir/ohdr.c.o"
+  "CMakeFiles/ohdr-shared.dir/ohdr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ohdr-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/ohdr"
+  "../bin/ohdr.pdb"
+  "CMakeFiles/ohdr.dir/ohdr.c.o"
+  "CMakeFiles/ohdr.dir/ohdr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ohdr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/page_buffer-shared"
+  "../bin/page_buffer-shared.pdb"
+  "CMakeFiles/page_buffer-shared.dir/page_buffer.c.o"
+  "CMakeFiles/page_buffer-shared.dir/page_buffer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/page_buffer-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
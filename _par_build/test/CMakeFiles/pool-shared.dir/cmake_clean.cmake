@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/pool-shared"
+  "../bin/pool-shared.pdb"
+  "CMakeFiles/pool-shared.dir/pool.c.o"
+  "CMakeFiles/pool-shared.dir/pool.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pool-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/reserved-shared"
+  "../bin/reserved-shared.pdb"
+  "CMakeFiles/reserved-shared.dir/reserved.c.o"
+  "CMakeFiles/reserved-shared.dir/reserved.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/reserved-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/reserved"
+  "../bin/reserved.pdb"
+  "CMakeFiles/reserved.dir/reserved.c.o"
+  "CMakeFiles/reserved.dir/reserved.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/reserved.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
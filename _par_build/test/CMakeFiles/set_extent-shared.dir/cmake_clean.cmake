@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/set_extent-shared"
+  "../bin/set_extent-shared.pdb"
+  "CMakeFiles/set_extent-shared.dir/set_extent.c.o"
+  "CMakeFiles/set_extent-shared.dir/set_extent.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/set_extent-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
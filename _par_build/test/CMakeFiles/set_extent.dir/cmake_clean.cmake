@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/set_extent"
+  "../bin/set_extent.pdb"
+  "CMakeFiles/set_extent.dir/set_extent.c.o"
+  "CMakeFiles/set_extent.dir/set_extent.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/set_extent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/stab-shared"
+  "../bin/stab-shared.pdb"
+  "CMakeFiles/stab-shared.dir/stab.c.o"
+  "CMakeFiles/stab-shared.dir/stab.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/stab-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr-shared"
+  "../bin/swmr-shared.pdb"
+  "CMakeFiles/swmr-shared.dir/swmr.c.o"
+  "CMakeFiles/swmr-shared.dir/swmr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_addrem_writer-shared"
+  "../bin/swmr_addrem_writer-shared.pdb"
+  "CMakeFiles/swmr_addrem_writer-shared.dir/swmr_addrem_writer.c.o"
+  "CMakeFiles/swmr_addrem_writer-shared.dir/swmr_addrem_writer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_addrem_writer-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_check_compat_vfd-shared"
+  "../bin/swmr_check_compat_vfd-shared.pdb"
+  "CMakeFiles/swmr_check_compat_vfd-shared.dir/swmr_check_compat_vfd.c.o"
+  "CMakeFiles/swmr_check_compat_vfd-shared.dir/swmr_check_compat_vfd.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_check_compat_vfd-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_generator-shared"
+  "../bin/swmr_generator-shared.pdb"
+  "CMakeFiles/swmr_generator-shared.dir/swmr_generator.c.o"
+  "CMakeFiles/swmr_generator-shared.dir/swmr_generator.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_generator-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
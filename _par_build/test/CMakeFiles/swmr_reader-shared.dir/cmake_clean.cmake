@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_reader-shared"
+  "../bin/swmr_reader-shared.pdb"
+  "CMakeFiles/swmr_reader-shared.dir/swmr_reader.c.o"
+  "CMakeFiles/swmr_reader-shared.dir/swmr_reader.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_reader-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
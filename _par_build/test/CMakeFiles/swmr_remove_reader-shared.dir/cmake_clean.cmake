@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_remove_reader-shared"
+  "../bin/swmr_remove_reader-shared.pdb"
+  "CMakeFiles/swmr_remove_reader-shared.dir/swmr_remove_reader.c.o"
+  "CMakeFiles/swmr_remove_reader-shared.dir/swmr_remove_reader.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_remove_reader-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
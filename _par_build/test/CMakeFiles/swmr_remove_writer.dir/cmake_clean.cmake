@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_remove_writer"
+  "../bin/swmr_remove_writer.pdb"
+  "CMakeFiles/swmr_remove_writer.dir/swmr_remove_writer.c.o"
+  "CMakeFiles/swmr_remove_writer.dir/swmr_remove_writer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_remove_writer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
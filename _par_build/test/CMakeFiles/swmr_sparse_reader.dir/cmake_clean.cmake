@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_sparse_reader"
+  "../bin/swmr_sparse_reader.pdb"
+  "CMakeFiles/swmr_sparse_reader.dir/swmr_sparse_reader.c.o"
+  "CMakeFiles/swmr_sparse_reader.dir/swmr_sparse_reader.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_sparse_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
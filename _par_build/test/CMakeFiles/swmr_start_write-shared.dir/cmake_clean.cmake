@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_start_write-shared"
+  "../bin/swmr_start_write-shared.pdb"
+  "CMakeFiles/swmr_start_write-shared.dir/swmr_start_write.c.o"
+  "CMakeFiles/swmr_start_write-shared.dir/swmr_start_write.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_start_write-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
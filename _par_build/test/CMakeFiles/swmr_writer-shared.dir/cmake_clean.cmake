@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/swmr_writer-shared"
+  "../bin/swmr_writer-shared.pdb"
+  "CMakeFiles/swmr_writer-shared.dir/swmr_writer.c.o"
+  "CMakeFiles/swmr_writer-shared.dir/swmr_writer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/swmr_writer-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
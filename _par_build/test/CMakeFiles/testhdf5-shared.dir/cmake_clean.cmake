@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "../bin/testhdf5-shared"
+  "../bin/testhdf5-shared.pdb"
+  "CMakeFiles/testhdf5-shared.dir/tarray.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tarray.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tattr.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tattr.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tchecksum.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tchecksum.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tconfig.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tconfig.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tcoords.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tcoords.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/testhdf5.c.o"
+  "CMakeFiles/testhdf5-shared.dir/testhdf5.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tfile.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tfile.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tgenprop.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tgenprop.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/th5o.c.o"
+  "CMakeFiles/testhdf5-shared.dir/th5o.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/th5s.c.o"
+  "CMakeFiles/testhdf5-shared.dir/th5s.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/theap.c.o"
+  "CMakeFiles/testhdf5-shared.dir/theap.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tid.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tid.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/titerate.c.o"
+  "CMakeFiles/testhdf5-shared.dir/titerate.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tmeta.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tmeta.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tmisc.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tmisc.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/trefer.c.o"
+  "CMakeFiles/testhdf5-shared.dir/trefer.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/trefstr.c.o"
+  "CMakeFiles/testhdf5-shared.dir/trefstr.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tselect.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tselect.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tskiplist.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tskiplist.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tsohm.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tsohm.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/ttime.c.o"
+  "CMakeFiles/testhdf5-shared.dir/ttime.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/ttst.c.o"
+  "CMakeFiles/testhdf5-shared.dir/ttst.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tunicode.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tunicode.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tvlstr.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tvlstr.c.o.d"
+  "CMakeFiles/testhdf5-shared.dir/tvltypes.c.o"
+  "CMakeFiles/testhdf5-shared.dir/tvltypes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testhdf5-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "../bin/testhdf5"
+  "../bin/testhdf5.pdb"
+  "CMakeFiles/testhdf5.dir/tarray.c.o"
+  "CMakeFiles/testhdf5.dir/tarray.c.o.d"
+  "CMakeFiles/testhdf5.dir/tattr.c.o"
+  "CMakeFiles/testhdf5.dir/tattr.c.o.d"
+  "CMakeFiles/testhdf5.dir/tchecksum.c.o"
+  "CMakeFiles/testhdf5.dir/tchecksum.c.o.d"
+  "CMakeFiles/testhdf5.dir/tconfig.c.o"
+  "CMakeFiles/testhdf5.dir/tconfig.c.o.d"
+  "CMakeFiles/testhdf5.dir/tcoords.c.o"
+  "CMakeFiles/testhdf5.dir/tcoords.c.o.d"
+  "CMakeFiles/testhdf5.dir/testhdf5.c.o"
+  "CMakeFiles/testhdf5.dir/testhdf5.c.o.d"
+  "CMakeFiles/testhdf5.dir/tfile.c.o"
+  "CMakeFiles/testhdf5.dir/tfile.c.o.d"
+  "CMakeFiles/testhdf5.dir/tgenprop.c.o"
+  "CMakeFiles/testhdf5.dir/tgenprop.c.o.d"
+  "CMakeFiles/testhdf5.dir/th5o.c.o"
+  "CMakeFiles/testhdf5.dir/th5o.c.o.d"
+  "CMakeFiles/testhdf5.dir/th5s.c.o"
+  "CMakeFiles/testhdf5.dir/th5s.c.o.d"
+  "CMakeFiles/testhdf5.dir/theap.c.o"
+  "CMakeFiles/testhdf5.dir/theap.c.o.d"
+  "CMakeFiles/testhdf5.dir/tid.c.o"
+  "CMakeFiles/testhdf5.dir/tid.c.o.d"
+  "CMakeFiles/testhdf5.dir/titerate.c.o"
+  "CMakeFiles/testhdf5.dir/titerate.c.o.d"
+  "CMakeFiles/testhdf5.dir/tmeta.c.o"
+  "CMakeFiles/testhdf5.dir/tmeta.c.o.d"
+  "CMakeFiles/testhdf5.dir/tmisc.c.o"
+  "CMakeFiles/testhdf5.dir/tmisc.c.o.d"
+  "CMakeFiles/testhdf5.dir/trefer.c.o"
+  "CMakeFiles/testhdf5.dir/trefer.c.o.d"
+  "CMakeFiles/testhdf5.dir/trefstr.c.o"
+  "CMakeFiles/testhdf5.dir/trefstr.c.o.d"
+  "CMakeFiles/testhdf5.dir/tselect.c.o"
+  "CMakeFiles/testhdf5.dir/tselect.c.o.d"
+  "CMakeFiles/testhdf5.dir/tskiplist.c.o"
+  "CMakeFiles/testhdf5.dir/tskiplist.c.o.d"
+  "CMakeFiles/testhdf5.dir/tsohm.c.o"
+  "CMakeFiles/testhdf5.dir/tsohm.c.o.d"
+  "CMakeFiles/testhdf5.dir/ttime.c.o"
+  "CMakeFiles/testhdf5.dir/ttime.c.o.d"
+  "CMakeFiles/testhdf5.dir/ttst.c.o"
+  "CMakeFiles/testhdf5.dir/ttst.c.o.d"
+  "CMakeFiles/testhdf5.dir/tunicode.c.o"
+  "CMakeFiles/testhdf5.dir/tunicode.c.o.d"
+  "CMakeFiles/testhdf5.dir/tvlstr.c.o"
+  "CMakeFiles/testhdf5.dir/tvlstr.c.o.d"
+  "CMakeFiles/testhdf5.dir/tvltypes.c.o"
+  "CMakeFiles/testhdf5.dir/tvltypes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testhdf5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
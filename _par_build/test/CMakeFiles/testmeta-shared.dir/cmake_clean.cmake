@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/testmeta-shared"
+  "../bin/testmeta-shared.pdb"
+  "CMakeFiles/testmeta-shared.dir/testmeta.c.o"
+  "CMakeFiles/testmeta-shared.dir/testmeta.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testmeta-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
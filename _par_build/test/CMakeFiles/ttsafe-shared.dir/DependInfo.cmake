@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ttsafe.c" "test/CMakeFiles/ttsafe-shared.dir/ttsafe.c.o" "gcc" "test/CMakeFiles/ttsafe-shared.dir/ttsafe.c.o.d"
+  "/root/repo/test/ttsafe_acreate.c" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_acreate.c.o" "gcc" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_acreate.c.o.d"
+  "/root/repo/test/ttsafe_cancel.c" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_cancel.c.o" "gcc" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_cancel.c.o.d"
+  "/root/repo/test/ttsafe_dcreate.c" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_dcreate.c.o" "gcc" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_dcreate.c.o.d"
+  "/root/repo/test/ttsafe_dread.c" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_dread.c.o" "gcc" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_dread.c.o.d"
+  "/root/repo/test/ttsafe_error.c" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_error.c.o" "gcc" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_error.c.o.d"
+  "/root/repo/test/ttsafe_id.c" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_id.c.o" "gcc" "test/CMakeFiles/ttsafe-shared.dir/ttsafe_id.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_par_build/test/CMakeFiles/hdf5_test-shared.dir/DependInfo.cmake"
+  "/root/repo/_par_build/src/CMakeFiles/hdf5-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../bin/ttsafe-shared"
+  "../bin/ttsafe-shared.pdb"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe.c.o"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe.c.o.d"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_acreate.c.o"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_acreate.c.o.d"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_cancel.c.o"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_cancel.c.o.d"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_dcreate.c.o"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_dcreate.c.o.d"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_dread.c.o"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_dread.c.o.d"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_error.c.o"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_error.c.o.d"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_id.c.o"
+  "CMakeFiles/ttsafe-shared.dir/ttsafe_id.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ttsafe-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/twriteorder-shared"
+  "../bin/twriteorder-shared.pdb"
+  "CMakeFiles/twriteorder-shared.dir/twriteorder.c.o"
+  "CMakeFiles/twriteorder-shared.dir/twriteorder.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/twriteorder-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unlink-shared"
+  "../bin/unlink-shared.pdb"
+  "CMakeFiles/unlink-shared.dir/unlink.c.o"
+  "CMakeFiles/unlink-shared.dir/unlink.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unlink-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
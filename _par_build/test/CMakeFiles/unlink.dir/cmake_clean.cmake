@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unlink"
+  "../bin/unlink.pdb"
+  "CMakeFiles/unlink.dir/unlink.c.o"
+  "CMakeFiles/unlink.dir/unlink.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unlink.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
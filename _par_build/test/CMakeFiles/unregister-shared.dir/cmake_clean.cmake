@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unregister-shared"
+  "../bin/unregister-shared.pdb"
+  "CMakeFiles/unregister-shared.dir/unregister.c.o"
+  "CMakeFiles/unregister-shared.dir/unregister.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unregister-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/use_append_chunk.c" "test/CMakeFiles/use_append_chunk.dir/use_append_chunk.c.o" "gcc" "test/CMakeFiles/use_append_chunk.dir/use_append_chunk.c.o.d"
+  "/root/repo/test/use_common.c" "test/CMakeFiles/use_append_chunk.dir/use_common.c.o" "gcc" "test/CMakeFiles/use_append_chunk.dir/use_common.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_par_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  "/root/repo/_par_build/test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/use_append_mchunks-shared"
+  "../bin/use_append_mchunks-shared.pdb"
+  "CMakeFiles/use_append_mchunks-shared.dir/use_append_mchunks.c.o"
+  "CMakeFiles/use_append_mchunks-shared.dir/use_append_mchunks.c.o.d"
+  "CMakeFiles/use_append_mchunks-shared.dir/use_common.c.o"
+  "CMakeFiles/use_append_mchunks-shared.dir/use_common.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/use_append_mchunks-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/use_disable_mdc_flushes-shared"
+  "../bin/use_disable_mdc_flushes-shared.pdb"
+  "CMakeFiles/use_disable_mdc_flushes-shared.dir/use_disable_mdc_flushes.c.o"
+  "CMakeFiles/use_disable_mdc_flushes-shared.dir/use_disable_mdc_flushes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/use_disable_mdc_flushes-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/vds-shared"
+  "../bin/vds-shared.pdb"
+  "CMakeFiles/vds-shared.dir/vds.c.o"
+  "CMakeFiles/vds-shared.dir/vds.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vds-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/vds_swmr_gen-shared"
+  "../bin/vds_swmr_gen-shared.pdb"
+  "CMakeFiles/vds_swmr_gen-shared.dir/vds_swmr_gen.c.o"
+  "CMakeFiles/vds_swmr_gen-shared.dir/vds_swmr_gen.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vds_swmr_gen-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/vds_swmr_reader-shared"
+  "../bin/vds_swmr_reader-shared.pdb"
+  "CMakeFiles/vds_swmr_reader-shared.dir/vds_swmr_reader.c.o"
+  "CMakeFiles/vds_swmr_reader-shared.dir/vds_swmr_reader.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vds_swmr_reader-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/vds_swmr_writer-shared"
+  "../bin/vds_swmr_writer-shared.pdb"
+  "CMakeFiles/vds_swmr_writer-shared.dir/vds_swmr_writer.c.o"
+  "CMakeFiles/vds_swmr_writer-shared.dir/vds_swmr_writer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vds_swmr_writer-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/vfd-shared"
+  "../bin/vfd-shared.pdb"
+  "CMakeFiles/vfd-shared.dir/vfd.c.o"
+  "CMakeFiles/vfd-shared.dir/vfd.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vfd-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,284 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_par_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(H5TEST-clear-testhdf5-objects "/usr/bin/cmake" "-E" "remove" "coord.h5" "dtypes10.h5" "sys_file1" "tattr.h5" "tfile1.h5" "tfile2.h5" "tfile3.h5" "tfile4.h5" "tfile5.h5" "tfile6.h5" "tfile7.h5" "tfilespace.h5" "th5o_file" "th5s1.h5" "tselect.h5" "tsohm.h5" "tsohm_dst.h5" "tsohm_src.h5")
+set_tests_properties(H5TEST-clear-testhdf5-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;260;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-testhdf5 "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/testhdf5" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=testhdf5.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-testhdf5 PROPERTIES  DEPENDS "H5TEST-clear-testhdf5-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;311;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-clear-testhdf5-objects "/usr/bin/cmake" "-E" "remove" "coord.h5" "dtypes10.h5" "sys_file1" "tattr.h5" "tfile1.h5" "tfile2.h5" "tfile3.h5" "tfile4.h5" "tfile5.h5" "tfile6.h5" "tfile7.h5" "tfilespace.h5" "th5o_file" "th5s1.h5" "tselect.h5" "tsohm.h5" "tsohm_dst.h5" "tsohm_src.h5")
+set_tests_properties(H5TEST-shared-clear-testhdf5-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;327;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-testhdf5 "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/testhdf5-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=testhdf5.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-testhdf5 PROPERTIES  DEPENDS "H5TEST-shared-clear-testhdf5-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;351;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-clear-objects "/usr/bin/cmake" "-E" "remove" "accum.h5" "cmpd_dset.h5" "compact_dataset.h5" "dataset.h5" "dset_offset.h5" "max_compact_dataset.h5" "simple.h5" "set_local.h5" "random_chunks.h5" "huge_chunks.h5" "chunk_cache.h5" "big_chunk.h5" "chunk_fast.h5" "chunk_expand.h5" "chunk_fixed.h5" "copy_dcpl_newfile.h5" "partial_chunks.h5" "layout_extend.h5" "zero_chunk.h5" "chunk_single.h5" "swmr_non_latest.h5" "earray_hdr_fd.h5" "farray_hdr_fd.h5" "bt2_hdr_fd.h5" "storage_size.h5" "dls_01_strings.h5" "extend.h5" "istore.h5" "extlinks*.h5" "frspace.h5" "links*.h5" "sys_file1" "tfile*.h5" "th5s*.h5" "lheap.h5" "fheap.h5" "ohdr.h5" "stab.h5" "extern_*.h5" "extern_*.raw" "gheap*.h5" "dt_arith1" "dt_arith2" "links.h5" "links*.h5" "extlinks16A00000.h5" "extlinks16A00001.h5" "extlinks16A00002.h5" "extlinks16B-b.h5" "extlinks16B-g.h5" "extlinks16B-l.h5" "extlinks16B-r.h5" "extlinks16B-s.h5" "extlinks19B00000.h5" "extlinks19B00001.h5" "extlinks19B00002.h5" "extlinks19B00003.h5" "extlinks19B00004.h5" "extlinks19B00005.h5" "extlinks19B00006.h5" "extlinks19B00007.h5" "extlinks19B00008.h5" "extlinks19B00009.h5" "extlinks19B00010.h5" "extlinks19B00011.h5" "extlinks19B00012.h5" "extlinks19B00013.h5" "extlinks19B00014.h5" "extlinks19B00015.h5" "extlinks19B00016.h5" "extlinks19B00017.h5" "extlinks19B00018.h5" "extlinks19B00019.h5" "extlinks19B00020.h5" "extlinks19B00021.h5" "extlinks19B00022.h5" "extlinks19B00023.h5" "extlinks19B00024.h5" "extlinks19B00025.h5" "extlinks19B00026.h5" "extlinks19B00027.h5" "extlinks19B00028.h5" "big.data" "big*.h5" "stdio.h5" "sec2.h5" "dtypes0.h5" "dtypes1.h5" "dtypes2.h5" "dtypes3.h5" "dtypes4.h5" "dtypes5.h5" "dtypes6.h5" "dtypes7.h5" "dtypes8.h5" "dtypes9.h5" "dtypes10.h5" "dt_arith1.h5" "dt_arith2.h5" "tattr.h5" "tselect.h5" "mtime.h5" "unlink.h5" "unicode.h5" "coord.h5" "fillval_*.h5" "fillval.raw" "mount_*.h5" "testmeta.h5" "ttime.h5" "trefer1.h5" "trefer2.h5" "trefer3.h5" "tvltypes.h5" "tvlstr.h5" "tvlstr2.h5" "twriteorder.dat" "flush.h5" "flush-swmr.h5" "noflush.h5" "noflush-swmr.h5" "flush_extend.h5" "flush_extend-swmr.h5" "noflush_extend.h5" "noflush_extend-swmr.h5" "enum1.h5" "titerate.h5" "ttsafe.h5" "tarray1.h5" "tgenprop.h5" "tmisc*.h5" "set_extent1.h5" "set_extent2.h5" "set_extent3.h5" "set_extent4.h5" "set_extent5.h5" "ext1.bin" "ext2.bin" "getname.h5" "getname1.h5" "getname2.h5" "getname3.h5" "sec2_file.h5" "direct_file.h5" "uring_file.h5" "mmap_file.h5" "family_file000*.h5" "new_family_v16_000*.h5" "multi_file-r.h5" "multi_file-s.h5" "core_file" "filter_plugin.h5" "new_move_a.h5" "new_move_b.h5" "ntypes.h5" "dangle.h5" "error_test.h5" "err_compat.h5" "dtransform.h5" "test_filters.h5" "get_file_name.h5" "tstint1.h5" "tstint2.h5" "unlink_chunked.h5" "btree2.h5" "btree2_tmp.h5" "objcopy_src.h5" "objcopy_dst.h5" "objcopy_ext.dat" "trefer1.h5" "trefer2.h5" "app_ref.h5" "farray.h5" "farray_tmp.h5" "earray.h5" "earray_tmp.h5" "efc0.h5" "efc1.h5" "efc2.h5" "efc3.h5" "efc4.h5" "efc5.h5" "log_vfd_out.log" "new_multi_file_v16-r.h5" "new_multi_file_v16-s.h5" "split_get_file_image_test-m.h5" "split_get_file_image_test-r.h5" "file_image_core_test.h5.copy" "unregister_filter_1.h5" "unregister_filter_2.h5" "vds_virt.h5" "vds_dapl.h5" "vds_src_0.h5" "vds_src_1.h5" "swmr_data.h5" "use_use_append_chunk.h5" "use_append_mchunks.h5" "use_disable_mdc_flushes.h5" "tbogus.h5.copy" "flushrefresh.h5" "flushrefresh_VERIFICATION_START" "flushrefresh_VERIFICATION_CHECKPOINT1" "flushrefresh_VERIFICATION_CHECKPOINT2" "flushrefresh_VERIFICATION_DONE" "filenotclosed.h5" "atomic_data" "accum_swmr_big.h5" "ohdr_swmr.h5" "test_swmr*.h5" "cache_logging.h5" "cache_logging.out" "vds_swmr.h5" "vds_swmr_src_*.h5" "tmp/vds_src_2.h5")
+set_tests_properties(H5TEST-clear-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;593;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache_api "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cache_api" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache_api.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cache_api PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache_tagging "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cache_tagging" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache_tagging.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cache_tagging PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-lheap "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/lheap" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=lheap.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-lheap PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-ohdr "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/ohdr" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ohdr.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-ohdr PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-stab "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/stab" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=stab.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-stab PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-gheap "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/gheap" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=gheap.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-gheap PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-evict_on_close "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/evict_on_close" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=evict_on_close.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-evict_on_close PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-farray "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/farray" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=farray.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-farray PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-earray "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/earray" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=earray.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-earray PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-btree2 "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/btree2" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=btree2.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-btree2 PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-fheap "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/fheap" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=fheap.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-fheap PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-pool "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/pool" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=pool.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-pool PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-accum "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/accum" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=accum.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-accum PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-istore "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/istore" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=istore.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-istore PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-bittests "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/bittests" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=bittests.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-bittests PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dt_arith "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dt_arith" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dt_arith.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dt_arith PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dtypes "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dtypes" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dtypes.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dtypes PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dsets "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dsets" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dsets.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dsets PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cmpd_dset "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cmpd_dset" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cmpd_dset.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cmpd_dset PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-filter_fail "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/filter_fail" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=filter_fail.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-filter_fail PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-extend "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/extend" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=extend.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-extend PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-external "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/external" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=external.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-external PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-efc "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/efc" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=efc.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-efc PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-objcopy "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/objcopy" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=objcopy.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-objcopy PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-links "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/links" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=links.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-links PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-unlink "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/unlink" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=unlink.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-unlink PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-twriteorder "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/twriteorder" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=twriteorder.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-twriteorder PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-big "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/big" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=big.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-big PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-mtime "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/mtime" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mtime.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-mtime PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-fillval "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/fillval" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=fillval.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-fillval PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-mount "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/mount" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mount.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-mount PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-flush1 "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/flush1" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=flush1.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-flush1 PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-flush2 "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/flush2" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=flush2.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-flush2 PROPERTIES  DEPENDS "H5TEST-flush1" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-app_ref "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/app_ref" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=app_ref.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-app_ref PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-enum "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/enum" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=enum.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-enum PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-set_extent "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/set_extent" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=set_extent.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-set_extent PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-ttsafe "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/ttsafe" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ttsafe.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-ttsafe PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-enc_dec_plist "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/enc_dec_plist" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=enc_dec_plist.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-enc_dec_plist PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-enc_dec_plist_cross_platform "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/enc_dec_plist_cross_platform" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=enc_dec_plist_cross_platform.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-enc_dec_plist_cross_platform PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-getname "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/getname" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=getname.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-getname PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-vfd "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/vfd" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=vfd.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-vfd PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-ntypes "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/ntypes" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ntypes.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-ntypes PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dangle "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dangle" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dangle.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dangle PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-dtransform "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dtransform" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dtransform.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-dtransform PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-reserved "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/reserved" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=reserved.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-reserved PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cross_read "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cross_read" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cross_read.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cross_read PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-freespace "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/freespace" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=freespace.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-freespace PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-mf "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/mf" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mf.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-mf PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-page_buffer "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/page_buffer" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=page_buffer.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-page_buffer PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-vds "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/vds" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=vds.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-vds PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-file_image "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/file_image" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=file_image.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-file_image PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-unregister "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/unregister" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=unregister.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-unregister PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache_logging "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cache_logging" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache_logging.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cache_logging PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cork "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cork" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cork.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cork PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-swmr "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/swmr" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=swmr.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-swmr PROPERTIES  DEPENDS "H5TEST-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;676;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-clear-objects "/usr/bin/cmake" "-E" "remove" "accum.h5" "cmpd_dset.h5" "compact_dataset.h5" "dataset.h5" "dset_offset.h5" "max_compact_dataset.h5" "simple.h5" "set_local.h5" "random_chunks.h5" "huge_chunks.h5" "chunk_cache.h5" "big_chunk.h5" "chunk_fast.h5" "chunk_expand.h5" "chunk_fixed.h5" "copy_dcpl_newfile.h5" "partial_chunks.h5" "layout_extend.h5" "zero_chunk.h5" "chunk_single.h5" "swmr_non_latest.h5" "earray_hdr_fd.h5" "farray_hdr_fd.h5" "bt2_hdr_fd.h5" "storage_size.h5" "dls_01_strings.h5" "extend.h5" "istore.h5" "extlinks*.h5" "frspace.h5" "links*.h5" "sys_file1" "tfile*.h5" "th5s*.h5" "lheap.h5" "fheap.h5" "ohdr.h5" "stab.h5" "extern_*.h5" "extern_*.raw" "gheap*.h5" "dt_arith1" "dt_arith2" "links.h5" "links*.h5" "extlinks16A00000.h5" "extlinks16A00001.h5" "extlinks16A00002.h5" "extlinks16B-b.h5" "extlinks16B-g.h5" "extlinks16B-l.h5" "extlinks16B-r.h5" "extlinks16B-s.h5" "extlinks19B00000.h5" "extlinks19B00001.h5" "extlinks19B00002.h5" "extlinks19B00003.h5" "extlinks19B00004.h5" "extlinks19B00005.h5" "extlinks19B00006.h5" "extlinks19B00007.h5" "extlinks19B00008.h5" "extlinks19B00009.h5" "extlinks19B00010.h5" "extlinks19B00011.h5" "extlinks19B00012.h5" "extlinks19B00013.h5" "extlinks19B00014.h5" "extlinks19B00015.h5" "extlinks19B00016.h5" "extlinks19B00017.h5" "extlinks19B00018.h5" "extlinks19B00019.h5" "extlinks19B00020.h5" "extlinks19B00021.h5" "extlinks19B00022.h5" "extlinks19B00023.h5" "extlinks19B00024.h5" "extlinks19B00025.h5" "extlinks19B00026.h5" "extlinks19B00027.h5" "extlinks19B00028.h5" "big.data" "big*.h5" "stdio.h5" "sec2.h5" "dtypes0.h5" "dtypes1.h5" "dtypes2.h5" "dtypes3.h5" "dtypes4.h5" "dtypes5.h5" "dtypes6.h5" "dtypes7.h5" "dtypes8.h5" "dtypes9.h5" "dtypes10.h5" "dt_arith1.h5" "dt_arith2.h5" "tattr.h5" "tselect.h5" "mtime.h5" "unlink.h5" "unicode.h5" "coord.h5" "fillval_*.h5" "fillval.raw" "mount_*.h5" "testmeta.h5" "ttime.h5" "trefer1.h5" "trefer2.h5" "trefer3.h5" "tvltypes.h5" "tvlstr.h5" "tvlstr2.h5" "twriteorder.dat" "flush.h5" "flush-swmr.h5" "noflush.h5" "noflush-swmr.h5" "flush_extend.h5" "flush_extend-swmr.h5" "noflush_extend.h5" "noflush_extend-swmr.h5" "enum1.h5" "titerate.h5" "ttsafe.h5" "tarray1.h5" "tgenprop.h5" "tmisc*.h5" "set_extent1.h5" "set_extent2.h5" "set_extent3.h5" "set_extent4.h5" "set_extent5.h5" "ext1.bin" "ext2.bin" "getname.h5" "getname1.h5" "getname2.h5" "getname3.h5" "sec2_file.h5" "direct_file.h5" "uring_file.h5" "mmap_file.h5" "family_file000*.h5" "new_family_v16_000*.h5" "multi_file-r.h5" "multi_file-s.h5" "core_file" "filter_plugin.h5" "new_move_a.h5" "new_move_b.h5" "ntypes.h5" "dangle.h5" "error_test.h5" "err_compat.h5" "dtransform.h5" "test_filters.h5" "get_file_name.h5" "tstint1.h5" "tstint2.h5" "unlink_chunked.h5" "btree2.h5" "btree2_tmp.h5" "objcopy_src.h5" "objcopy_dst.h5" "objcopy_ext.dat" "trefer1.h5" "trefer2.h5" "app_ref.h5" "farray.h5" "farray_tmp.h5" "earray.h5" "earray_tmp.h5" "efc0.h5" "efc1.h5" "efc2.h5" "efc3.h5" "efc4.h5" "efc5.h5" "log_vfd_out.log" "new_multi_file_v16-r.h5" "new_multi_file_v16-s.h5" "split_get_file_image_test-m.h5" "split_get_file_image_test-r.h5" "file_image_core_test.h5.copy" "unregister_filter_1.h5" "unregister_filter_2.h5" "vds_virt.h5" "vds_dapl.h5" "vds_src_0.h5" "vds_src_1.h5" "swmr_data.h5" "use_use_append_chunk.h5" "use_append_mchunks.h5" "use_disable_mdc_flushes.h5" "tbogus.h5.copy" "flushrefresh.h5" "flushrefresh_VERIFICATION_START" "flushrefresh_VERIFICATION_CHECKPOINT1" "flushrefresh_VERIFICATION_CHECKPOINT2" "flushrefresh_VERIFICATION_DONE" "filenotclosed.h5" "atomic_data" "accum_swmr_big.h5" "ohdr_swmr.h5" "test_swmr*.h5" "cache_logging.h5" "cache_logging.out" "vds_swmr.h5" "vds_swmr_src_*.h5" "tmp/vds_src_2.h5")
+set_tests_properties(H5TEST-shared-clear-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;703;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-cache_api "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cache_api-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache_api.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-cache_api PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-cache_tagging "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cache_tagging-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache_tagging.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-cache_tagging PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-lheap "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/lheap-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=lheap.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-lheap PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-ohdr "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/ohdr-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ohdr.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-ohdr PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-stab "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/stab-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=stab.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-stab PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-gheap "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/gheap-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=gheap.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-gheap PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-evict_on_close "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/evict_on_close-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=evict_on_close.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-evict_on_close PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-farray "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/farray-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=farray.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-farray PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-earray "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/earray-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=earray.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-earray PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-btree2 "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/btree2-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=btree2.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-btree2 PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-fheap "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/fheap-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=fheap.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-fheap PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-pool "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/pool-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=pool.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-pool PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-accum "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/accum-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=accum.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-accum PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-istore "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/istore-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=istore.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-istore PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-bittests "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/bittests-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=bittests.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-bittests PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-dt_arith "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dt_arith-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dt_arith.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-dt_arith PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-dtypes "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dtypes-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dtypes.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-dtypes PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-dsets "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dsets-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dsets.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-dsets PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-cmpd_dset "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cmpd_dset-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cmpd_dset.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-cmpd_dset PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-filter_fail "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/filter_fail-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=filter_fail.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-filter_fail PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-extend "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/extend-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=extend.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-extend PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-external "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/external-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=external.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-external PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-efc "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/efc-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=efc.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-efc PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-objcopy "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/objcopy-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=objcopy.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-objcopy PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-links "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/links-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=links.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-links PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-unlink "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/unlink-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=unlink.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-unlink PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-twriteorder "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/twriteorder-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=twriteorder.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-twriteorder PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-big "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/big-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=big.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-big PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-mtime "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/mtime-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mtime.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-mtime PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-fillval "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/fillval-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=fillval.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-fillval PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-mount "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/mount-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mount.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-mount PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-flush1 "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/flush1-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=flush1.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-flush1 PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-flush2 "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/flush2-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=flush2.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-flush2 PROPERTIES  DEPENDS "H5TEST-shared-flush1" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-app_ref "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/app_ref-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=app_ref.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-app_ref PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-enum "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/enum-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=enum.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-enum PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-set_extent "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/set_extent-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=set_extent.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-set_extent PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-ttsafe "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/ttsafe-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ttsafe.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-ttsafe PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-enc_dec_plist "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/enc_dec_plist-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=enc_dec_plist.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-enc_dec_plist PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-enc_dec_plist_cross_platform "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/enc_dec_plist_cross_platform-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=enc_dec_plist_cross_platform.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-enc_dec_plist_cross_platform PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-getname "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/getname-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=getname.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-getname PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-vfd "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/vfd-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=vfd.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-vfd PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-ntypes "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/ntypes-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=ntypes.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-ntypes PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-dangle "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dangle-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dangle.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-dangle PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-dtransform "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/dtransform-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=dtransform.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-dtransform PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-reserved "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/reserved-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=reserved.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-reserved PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-cross_read "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cross_read-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cross_read.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-cross_read PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-freespace "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/freespace-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=freespace.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-freespace PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-mf "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/mf-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=mf.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-mf PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-page_buffer "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/page_buffer-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=page_buffer.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-page_buffer PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-vds "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/vds-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=vds.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-vds PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-file_image "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/file_image-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=file_image.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-file_image PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-unregister "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/unregister-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=unregister.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-unregister PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-cache_logging "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cache_logging-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache_logging.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-cache_logging PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-cork "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cork-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cork.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-cork PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-swmr "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/swmr-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=swmr.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-swmr PROPERTIES  DEPENDS "H5TEST-shared-clear-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;717;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-clear-cache-objects "/usr/bin/cmake" "-E" "remove" "cache_test.h5")
+set_tests_properties(H5TEST-clear-cache-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;750;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cache" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-cache PROPERTIES  DEPENDS "H5TEST-clear-cache-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST;HDF5TestExpress=3" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;760;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-clear-cache_image-objects "/usr/bin/cmake" "-E" "remove" "cache_image_test.h5")
+set_tests_properties(H5TEST-clear-cache_image-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;780;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-cache_image "/root/repo/_par_build/bin/cache_image")
+set_tests_properties(H5TEST-cache_image PROPERTIES  DEPENDS "H5TEST-clear-cache_image-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST;HDF5TestExpress=3" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;788;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-clear-filenotclosed-objects "/usr/bin/cmake" "-E" "remove" "filenotclosed.h5")
+set_tests_properties(H5TEST-clear-filenotclosed-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;796;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-filenotclosed "/root/repo/_par_build/bin/filenotclosed")
+set_tests_properties(H5TEST-filenotclosed PROPERTIES  DEPENDS "H5TEST-clear-filenotclosed-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;804;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-clear-err_compat-objects "/usr/bin/cmake" "-E" "remove" "err_compat.txt" "err_compat.txt.err")
+set_tests_properties(H5TEST-clear-err_compat-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;813;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-err_compat "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/err_compat" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_MASK_ERROR=true" "-D" "TEST_OUTPUT=err_compat.txt" "-D" "TEST_REFERENCE=err_compat_1" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-err_compat PROPERTIES  DEPENDS "H5TEST-clear-err_compat-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;821;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-clear-error_test-objects "/usr/bin/cmake" "-E" "remove" "error_test.txt" "error_test.txt.err")
+set_tests_properties(H5TEST-clear-error_test-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;839;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-error_test "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/error_test" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_MASK_ERROR=true" "-D" "TEST_OUTPUT=error_test.txt" "-D" "TEST_REFERENCE=error_test_1" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-error_test PROPERTIES  DEPENDS "H5TEST-clear-error_test-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST;HDF5_PLUGIN_PRELOAD=::" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;853;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-clear-links_env-objects "/usr/bin/cmake" "-E" "remove" "links_env.txt" "links_env.txt.err" "extlinks_env0.h5" "extlinks_env1.h5" "tmp/extlinks_env1.h5")
+set_tests_properties(H5TEST-clear-links_env-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;871;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-links_env "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/links_env" "-D" "TEST_ARGS:STRING=" "-D" "TEST_ENV_VAR:STRING=HDF5_EXT_PREFIX" "-D" "TEST_ENV_VALUE:STRING=.:tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=links_env.txt" "-D" "TEST_REFERENCE=links_env.out" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-links_env PROPERTIES  DEPENDS "H5TEST-clear-links_env-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;882;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-testlibinfo "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/libhdf5.a" "-P" "/root/repo/_par_build/test/GrepRunner.cmake")
+set_tests_properties(H5TEST-testlibinfo PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;900;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-clear-cache-objects "/usr/bin/cmake" "-E" "remove" "cache_test.h5")
+set_tests_properties(H5TEST-shared-clear-cache-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;909;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-cache "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/cache-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_SKIP_COMPARE=TRUE" "-D" "TEST_OUTPUT=cache-shared.txt" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-cache PROPERTIES  DEPENDS "H5TEST-shared-clear-cache-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared;HDF5TestExpress=OFF" TIMEOUT "1800" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;919;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-clear-err_compat-objects "/usr/bin/cmake" "-E" "remove" "err_compat.txt" "err_compat.txt.err")
+set_tests_properties(H5TEST-shared-clear-err_compat-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;940;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-err_compat "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/err_compat-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_MASK_ERROR=true" "-D" "TEST_OUTPUT=err_compat.txt" "-D" "TEST_REFERENCE=err_compat_1" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-err_compat PROPERTIES  DEPENDS "H5TEST-shared-clear-err_compat-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;948;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-clear-error_test-objects "/usr/bin/cmake" "-E" "remove" "error_test.txt" "error_test.txt.err")
+set_tests_properties(H5TEST-shared-clear-error_test-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;966;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-error_test "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/error_test-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_EXPECT=0" "-D" "TEST_MASK_ERROR=true" "-D" "TEST_OUTPUT=error_test.txt" "-D" "TEST_REFERENCE=error_test_1" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-error_test PROPERTIES  DEPENDS "H5TEST-shared-clear-error_test-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared;HDF5_PLUGIN_PRELOAD=::" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;980;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-clear-links_env-objects "/usr/bin/cmake" "-E" "remove" "links_env.txt" "links_env.txt.err" "extlinks_env0.h5" "extlinks_env1.h5" "tmp/extlinks_env1.h5")
+set_tests_properties(H5TEST-shared-clear-links_env-objects PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;998;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-links_env "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/links_env-shared" "-D" "TEST_ARGS:STRING=" "-D" "TEST_ENV_VAR:STRING=HDF5_EXT_PREFIX" "-D" "TEST_ENV_VALUE:STRING=.:tmp" "-D" "TEST_EXPECT=0" "-D" "TEST_OUTPUT=links_env.txt" "-D" "TEST_REFERENCE=links_env.out" "-D" "TEST_FOLDER=/root/repo/_par_build/test/H5TEST-shared" "-P" "/root/repo/config/cmake_ext_mod/runTest.cmake")
+set_tests_properties(H5TEST-shared-links_env PROPERTIES  DEPENDS "H5TEST-shared-clear-links_env-objects" ENVIRONMENT "srcdir=/root/repo/_par_build/test/H5TEST-shared" WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;1009;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5TEST-shared-testlibinfo "/usr/bin/cmake" "-D" "TEST_PROGRAM=/root/repo/_par_build/bin/libhdf5.so.1.11.0" "-P" "/root/repo/_par_build/test/GrepRunner.cmake")
+set_tests_properties(H5TEST-shared-testlibinfo PROPERTIES  WORKING_DIRECTORY "/root/repo/_par_build/test/H5TEST-shared" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;1027;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
+add_test(H5PLUGIN-filter_plugin "/root/repo/_par_build/bin/filter_plugin")
+set_tests_properties(H5PLUGIN-filter_plugin PROPERTIES  ENVIRONMENT "HDF5_PLUGIN_PATH=/root/repo/_par_build/filter_plugin_dir1:/root/repo/_par_build/filter_plugin_dir2;srcdir=/root/repo/_par_build/test" WORKING_DIRECTORY "/root/repo/_par_build/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeTests.cmake;1045;add_test;/root/repo/test/CMakeTests.cmake;0;;/root/repo/test/CMakeLists.txt;476;include;/root/repo/test/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_bigio"
+  "../bin/t_bigio.pdb"
+  "CMakeFiles/t_bigio.dir/t_bigio.c.o"
+  "CMakeFiles/t_bigio.dir/t_bigio.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_bigio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_cache"
+  "../bin/t_cache.pdb"
+  "CMakeFiles/t_cache.dir/t_cache.c.o"
+  "CMakeFiles/t_cache.dir/t_cache.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_filters_parallel"
+  "../bin/t_filters_parallel.pdb"
+  "CMakeFiles/t_filters_parallel.dir/t_filters_parallel.c.o"
+  "CMakeFiles/t_filters_parallel.dir/t_filters_parallel.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_filters_parallel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_init_term"
+  "../bin/t_init_term.pdb"
+  "CMakeFiles/t_init_term.dir/t_init_term.c.o"
+  "CMakeFiles/t_init_term.dir/t_init_term.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_init_term.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
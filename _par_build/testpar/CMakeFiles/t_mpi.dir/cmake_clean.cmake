@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_mpi"
+  "../bin/t_mpi.pdb"
+  "CMakeFiles/t_mpi.dir/t_mpi.c.o"
+  "CMakeFiles/t_mpi.dir/t_mpi.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_mpi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
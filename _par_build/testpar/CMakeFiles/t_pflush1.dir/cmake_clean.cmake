@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_pflush1"
+  "../bin/t_pflush1.pdb"
+  "CMakeFiles/t_pflush1.dir/t_pflush1.c.o"
+  "CMakeFiles/t_pflush1.dir/t_pflush1.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_pflush1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_pflush2"
+  "../bin/t_pflush2.pdb"
+  "CMakeFiles/t_pflush2.dir/t_pflush2.c.o"
+  "CMakeFiles/t_pflush2.dir/t_pflush2.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_pflush2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_pread"
+  "../bin/t_pread.pdb"
+  "CMakeFiles/t_pread.dir/t_pread.c.o"
+  "CMakeFiles/t_pread.dir/t_pread.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_pread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_prestart"
+  "../bin/t_prestart.pdb"
+  "CMakeFiles/t_prestart.dir/t_prestart.c.o"
+  "CMakeFiles/t_prestart.dir/t_prestart.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_prestart.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
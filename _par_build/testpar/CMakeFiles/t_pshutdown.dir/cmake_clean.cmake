@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_pshutdown"
+  "../bin/t_pshutdown.pdb"
+  "CMakeFiles/t_pshutdown.dir/t_pshutdown.c.o"
+  "CMakeFiles/t_pshutdown.dir/t_pshutdown.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_pshutdown.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
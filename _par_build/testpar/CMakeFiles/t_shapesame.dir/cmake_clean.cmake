@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t_shapesame"
+  "../bin/t_shapesame.pdb"
+  "CMakeFiles/t_shapesame.dir/t_shapesame.c.o"
+  "CMakeFiles/t_shapesame.dir/t_shapesame.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/t_shapesame.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/testpar/t_chunk_alloc.c" "testpar/CMakeFiles/testphdf5.dir/t_chunk_alloc.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_chunk_alloc.c.o.d"
+  "/root/repo/testpar/t_coll_chunk.c" "testpar/CMakeFiles/testphdf5.dir/t_coll_chunk.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_coll_chunk.c.o.d"
+  "/root/repo/testpar/t_dset.c" "testpar/CMakeFiles/testphdf5.dir/t_dset.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_dset.c.o.d"
+  "/root/repo/testpar/t_file.c" "testpar/CMakeFiles/testphdf5.dir/t_file.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_file.c.o.d"
+  "/root/repo/testpar/t_file_image.c" "testpar/CMakeFiles/testphdf5.dir/t_file_image.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_file_image.c.o.d"
+  "/root/repo/testpar/t_filter_read.c" "testpar/CMakeFiles/testphdf5.dir/t_filter_read.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_filter_read.c.o.d"
+  "/root/repo/testpar/t_mdset.c" "testpar/CMakeFiles/testphdf5.dir/t_mdset.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_mdset.c.o.d"
+  "/root/repo/testpar/t_ph5basic.c" "testpar/CMakeFiles/testphdf5.dir/t_ph5basic.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_ph5basic.c.o.d"
+  "/root/repo/testpar/t_prop.c" "testpar/CMakeFiles/testphdf5.dir/t_prop.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_prop.c.o.d"
+  "/root/repo/testpar/t_span_tree.c" "testpar/CMakeFiles/testphdf5.dir/t_span_tree.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/t_span_tree.c.o.d"
+  "/root/repo/testpar/testphdf5.c" "testpar/CMakeFiles/testphdf5.dir/testphdf5.c.o" "gcc" "testpar/CMakeFiles/testphdf5.dir/testphdf5.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_par_build/test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  "/root/repo/_par_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../bin/testphdf5"
+  "../bin/testphdf5.pdb"
+  "CMakeFiles/testphdf5.dir/t_chunk_alloc.c.o"
+  "CMakeFiles/testphdf5.dir/t_chunk_alloc.c.o.d"
+  "CMakeFiles/testphdf5.dir/t_coll_chunk.c.o"
+  "CMakeFiles/testphdf5.dir/t_coll_chunk.c.o.d"
+  "CMakeFiles/testphdf5.dir/t_dset.c.o"
+  "CMakeFiles/testphdf5.dir/t_dset.c.o.d"
+  "CMakeFiles/testphdf5.dir/t_file.c.o"
+  "CMakeFiles/testphdf5.dir/t_file.c.o.d"
+  "CMakeFiles/testphdf5.dir/t_file_image.c.o"
+  "CMakeFiles/testphdf5.dir/t_file_image.c.o.d"
+  "CMakeFiles/testphdf5.dir/t_filter_read.c.o"
+  "CMakeFiles/testphdf5.dir/t_filter_read.c.o.d"
+  "CMakeFiles/testphdf5.dir/t_mdset.c.o"
+  "CMakeFiles/testphdf5.dir/t_mdset.c.o.d"
+  "CMakeFiles/testphdf5.dir/t_ph5basic.c.o"
+  "CMakeFiles/testphdf5.dir/t_ph5basic.c.o.d"
+  "CMakeFiles/testphdf5.dir/t_prop.c.o"
+  "CMakeFiles/testphdf5.dir/t_prop.c.o.d"
+  "CMakeFiles/testphdf5.dir/t_span_tree.c.o"
+  "CMakeFiles/testphdf5.dir/t_span_tree.c.o.d"
+  "CMakeFiles/testphdf5.dir/testphdf5.c.o"
+  "CMakeFiles/testphdf5.dir/testphdf5.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testphdf5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testpar
+# Build directory: /root/repo/_par_build/testpar
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(TEST_PAR_testphdf5 "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/testphdf5")
+set_tests_properties(TEST_PAR_testphdf5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;19;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_mpi "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_mpi")
+set_tests_properties(TEST_PAR_t_mpi PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_bigio "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_bigio")
+set_tests_properties(TEST_PAR_t_bigio PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_cache "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_cache")
+set_tests_properties(TEST_PAR_t_cache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_pflush1 "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_pflush1")
+set_tests_properties(TEST_PAR_t_pflush1 PROPERTIES  PASS_REGULAR_EXPRESSION "PASSED" _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_pflush2 "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_pflush2")
+set_tests_properties(TEST_PAR_t_pflush2 PROPERTIES  DEPENDS "TEST_PAR_t_pflush1" _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_pread "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_pread")
+set_tests_properties(TEST_PAR_t_pread PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_pshutdown "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_pshutdown")
+set_tests_properties(TEST_PAR_t_pshutdown PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_prestart "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_prestart")
+set_tests_properties(TEST_PAR_t_prestart PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_init_term "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_init_term")
+set_tests_properties(TEST_PAR_t_init_term PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_shapesame "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_shapesame")
+set_tests_properties(TEST_PAR_t_shapesame PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
+add_test(TEST_PAR_t_filters_parallel "/usr/bin/mpiexec" "-n" "1" "/root/repo/_par_build/bin/t_filters_parallel")
+set_tests_properties(TEST_PAR_t_filters_parallel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/testpar/CMakeTests.cmake;22;add_test;/root/repo/testpar/CMakeTests.cmake;0;;/root/repo/testpar/CMakeLists.txt;62;include;/root/repo/testpar/CMakeLists.txt;0;")
@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "../../bin/libhdf5_tools.pdb"
+  "../../bin/libhdf5_tools.so"
+  "../../bin/libhdf5_tools.so.1.11.0"
+  "../../bin/libhdf5_tools.so.1000.0.0"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff_array.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff_array.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff_attr.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff_attr.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff_dset.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff_dset.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff_util.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5diff_util.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_dump.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_dump.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_filters.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_filters.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_ref.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_ref.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_str.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_str.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_type.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_type.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_utils.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5tools_utils.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/h5trav.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/h5trav.c.o.d"
+  "CMakeFiles/hdf5_tools-shared.dir/io_timer.c.o"
+  "CMakeFiles/hdf5_tools-shared.dir/io_timer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf5_tools-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/lib/h5diff.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff.c.o.d"
+  "/root/repo/tools/lib/h5diff_array.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff_array.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff_array.c.o.d"
+  "/root/repo/tools/lib/h5diff_attr.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff_attr.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff_attr.c.o.d"
+  "/root/repo/tools/lib/h5diff_dset.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff_dset.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff_dset.c.o.d"
+  "/root/repo/tools/lib/h5diff_util.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff_util.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5diff_util.c.o.d"
+  "/root/repo/tools/lib/h5tools.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools.c.o.d"
+  "/root/repo/tools/lib/h5tools_dump.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_dump.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_dump.c.o.d"
+  "/root/repo/tools/lib/h5tools_filters.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_filters.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_filters.c.o.d"
+  "/root/repo/tools/lib/h5tools_ref.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_ref.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_ref.c.o.d"
+  "/root/repo/tools/lib/h5tools_str.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_str.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_str.c.o.d"
+  "/root/repo/tools/lib/h5tools_type.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_type.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_type.c.o.d"
+  "/root/repo/tools/lib/h5tools_utils.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_utils.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5tools_utils.c.o.d"
+  "/root/repo/tools/lib/h5trav.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5trav.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/h5trav.c.o.d"
+  "/root/repo/tools/lib/io_timer.c" "tools/lib/CMakeFiles/hdf5_tools-static.dir/io_timer.c.o" "gcc" "tools/lib/CMakeFiles/hdf5_tools-static.dir/io_timer.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_par_build/src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
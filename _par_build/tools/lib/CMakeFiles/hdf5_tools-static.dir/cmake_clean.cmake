@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "../../bin/libhdf5_tools.a"
+  "../../bin/libhdf5_tools.pdb"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff_array.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff_array.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff_attr.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff_attr.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff_dset.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff_dset.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff_util.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5diff_util.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_dump.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_dump.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_filters.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_filters.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_ref.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_ref.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_str.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_str.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_type.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_type.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_utils.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5tools_utils.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/h5trav.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/h5trav.c.o.d"
+  "CMakeFiles/hdf5_tools-static.dir/io_timer.c.o"
+  "CMakeFiles/hdf5_tools-static.dir/io_timer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf5_tools-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
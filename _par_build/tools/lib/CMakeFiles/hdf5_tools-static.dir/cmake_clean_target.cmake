@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../bin/libhdf5_tools.a"
+)
@@ -0,0 +1,326 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeFilters.cmake"
+  "/root/repo/CMakeInstallation.cmake"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "/root/repo/UserMacros.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/config/cmake/CTestCustom.cmake"
+  "/root/repo/config/cmake/ConfigureChecks.cmake"
+  "/root/repo/config/cmake/ConversionTests.c"
+  "/root/repo/config/cmake/H5pubconf.h.in"
+  "/root/repo/config/cmake/HDF5Macros.cmake"
+  "/root/repo/config/cmake/HDFCompilerFlags.cmake"
+  "/root/repo/config/cmake/README.txt.cmake.in"
+  "/root/repo/config/cmake/hdf5-config-version.cmake.in"
+  "/root/repo/config/cmake/hdf5-config.cmake.in"
+  "/root/repo/config/cmake/libhdf5.settings.cmake.in"
+  "/root/repo/config/cmake_ext_mod/ConfigureChecks.cmake"
+  "/root/repo/config/cmake_ext_mod/HDFCXXTests.cpp"
+  "/root/repo/config/cmake_ext_mod/HDFLibMacros.cmake"
+  "/root/repo/config/cmake_ext_mod/HDFMacros.cmake"
+  "/root/repo/config/cmake_ext_mod/HDFTests.c"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/CMakeTests.cmake"
+  "/root/repo/test/H5srcdir_str.h.in"
+  "/root/repo/tools/lib/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFortranFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckVariableExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCygwin.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMsys.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPerl.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/TestForSTDNamespace.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CTestCustom.ctest"
+  "H5pubconf.h"
+  "hdf5-config.cmake"
+  "CMakeFiles/hdf5-config.cmake"
+  "CMakeFiles/hdf5-config-version.cmake"
+  "libhdf5.settings"
+  "README.txt"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/H5srcdir_str.h"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "src/CMakeFiles/H5detect.dir/DependInfo.cmake"
+  "src/CMakeFiles/H5make_libsettings.dir/DependInfo.cmake"
+  "src/CMakeFiles/hdf5-static.dir/DependInfo.cmake"
+  "src/CMakeFiles/hdf5-shared.dir/DependInfo.cmake"
+  "tools/lib/CMakeFiles/hdf5_tools-static.dir/DependInfo.cmake"
+  "tools/lib/CMakeFiles/hdf5_tools-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/hdf5_test-static.dir/DependInfo.cmake"
+  "test/CMakeFiles/hdf5_test-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/filter_plugin1_dsets.dir/DependInfo.cmake"
+  "test/CMakeFiles/filter_plugin3_dsets.dir/DependInfo.cmake"
+  "test/CMakeFiles/filter_plugin2_dsets.dir/DependInfo.cmake"
+  "test/CMakeFiles/filter_plugin4_groups.dir/DependInfo.cmake"
+  "test/CMakeFiles/testhdf5.dir/DependInfo.cmake"
+  "test/CMakeFiles/testhdf5-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_api.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_api-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_tagging.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_tagging-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/lheap.dir/DependInfo.cmake"
+  "test/CMakeFiles/lheap-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/ohdr.dir/DependInfo.cmake"
+  "test/CMakeFiles/ohdr-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/stab.dir/DependInfo.cmake"
+  "test/CMakeFiles/stab-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/gheap.dir/DependInfo.cmake"
+  "test/CMakeFiles/gheap-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/evict_on_close.dir/DependInfo.cmake"
+  "test/CMakeFiles/evict_on_close-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/farray.dir/DependInfo.cmake"
+  "test/CMakeFiles/farray-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/earray.dir/DependInfo.cmake"
+  "test/CMakeFiles/earray-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/btree2.dir/DependInfo.cmake"
+  "test/CMakeFiles/btree2-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/fheap.dir/DependInfo.cmake"
+  "test/CMakeFiles/fheap-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/pool.dir/DependInfo.cmake"
+  "test/CMakeFiles/pool-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/accum.dir/DependInfo.cmake"
+  "test/CMakeFiles/accum-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/istore.dir/DependInfo.cmake"
+  "test/CMakeFiles/istore-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/bittests.dir/DependInfo.cmake"
+  "test/CMakeFiles/bittests-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/dt_arith.dir/DependInfo.cmake"
+  "test/CMakeFiles/dt_arith-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/dtypes.dir/DependInfo.cmake"
+  "test/CMakeFiles/dtypes-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/dsets.dir/DependInfo.cmake"
+  "test/CMakeFiles/dsets-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/cmpd_dset.dir/DependInfo.cmake"
+  "test/CMakeFiles/cmpd_dset-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/filter_fail.dir/DependInfo.cmake"
+  "test/CMakeFiles/filter_fail-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/extend.dir/DependInfo.cmake"
+  "test/CMakeFiles/extend-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/external.dir/DependInfo.cmake"
+  "test/CMakeFiles/external-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/efc.dir/DependInfo.cmake"
+  "test/CMakeFiles/efc-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/objcopy.dir/DependInfo.cmake"
+  "test/CMakeFiles/objcopy-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/links.dir/DependInfo.cmake"
+  "test/CMakeFiles/links-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/unlink.dir/DependInfo.cmake"
+  "test/CMakeFiles/unlink-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/twriteorder.dir/DependInfo.cmake"
+  "test/CMakeFiles/twriteorder-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/big.dir/DependInfo.cmake"
+  "test/CMakeFiles/big-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/mtime.dir/DependInfo.cmake"
+  "test/CMakeFiles/mtime-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/fillval.dir/DependInfo.cmake"
+  "test/CMakeFiles/fillval-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/mount.dir/DependInfo.cmake"
+  "test/CMakeFiles/mount-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/flush1.dir/DependInfo.cmake"
+  "test/CMakeFiles/flush1-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/flush2.dir/DependInfo.cmake"
+  "test/CMakeFiles/flush2-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/app_ref.dir/DependInfo.cmake"
+  "test/CMakeFiles/app_ref-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/enum.dir/DependInfo.cmake"
+  "test/CMakeFiles/enum-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/set_extent.dir/DependInfo.cmake"
+  "test/CMakeFiles/set_extent-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/enc_dec_plist.dir/DependInfo.cmake"
+  "test/CMakeFiles/enc_dec_plist-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/enc_dec_plist_cross_platform.dir/DependInfo.cmake"
+  "test/CMakeFiles/enc_dec_plist_cross_platform-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/getname.dir/DependInfo.cmake"
+  "test/CMakeFiles/getname-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/vfd.dir/DependInfo.cmake"
+  "test/CMakeFiles/vfd-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/ntypes.dir/DependInfo.cmake"
+  "test/CMakeFiles/ntypes-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/dangle.dir/DependInfo.cmake"
+  "test/CMakeFiles/dangle-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/dtransform.dir/DependInfo.cmake"
+  "test/CMakeFiles/dtransform-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/reserved.dir/DependInfo.cmake"
+  "test/CMakeFiles/reserved-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/cross_read.dir/DependInfo.cmake"
+  "test/CMakeFiles/cross_read-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/freespace.dir/DependInfo.cmake"
+  "test/CMakeFiles/freespace-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/mf.dir/DependInfo.cmake"
+  "test/CMakeFiles/mf-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/page_buffer.dir/DependInfo.cmake"
+  "test/CMakeFiles/page_buffer-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/file_image.dir/DependInfo.cmake"
+  "test/CMakeFiles/file_image-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/unregister.dir/DependInfo.cmake"
+  "test/CMakeFiles/unregister-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_logging.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_logging-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/cork.dir/DependInfo.cmake"
+  "test/CMakeFiles/cork-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_addrem_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_addrem_writer-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_check_compat_vfd.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_check_compat_vfd-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_generator.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_generator-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_reader-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_remove_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_remove_reader-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_remove_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_remove_writer-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_sparse_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_sparse_reader-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_sparse_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_sparse_writer-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_start_write.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_start_write-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/swmr_writer-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_swmr_gen.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_swmr_gen-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_swmr_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_swmr_reader-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_swmr_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/vds_swmr_writer-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_image.dir/DependInfo.cmake"
+  "test/CMakeFiles/cache_image-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/hyperslab.dir/DependInfo.cmake"
+  "test/CMakeFiles/hyperslab-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/ttsafe.dir/DependInfo.cmake"
+  "test/CMakeFiles/ttsafe-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/error_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/error_test-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/err_compat.dir/DependInfo.cmake"
+  "test/CMakeFiles/err_compat-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/tcheck_version.dir/DependInfo.cmake"
+  "test/CMakeFiles/tcheck_version-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/testmeta.dir/DependInfo.cmake"
+  "test/CMakeFiles/testmeta-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/atomic_writer.dir/DependInfo.cmake"
+  "test/CMakeFiles/atomic_writer-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/atomic_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/atomic_reader-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/links_env.dir/DependInfo.cmake"
+  "test/CMakeFiles/links_env-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/flushrefresh.dir/DependInfo.cmake"
+  "test/CMakeFiles/flushrefresh-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/filenotclosed.dir/DependInfo.cmake"
+  "test/CMakeFiles/filenotclosed-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/accum_swmr_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/filter_plugin.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_append_chunk.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_append_chunk-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_append_mchunks.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_append_mchunks-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_disable_mdc_flushes.dir/DependInfo.cmake"
+  "test/CMakeFiles/use_disable_mdc_flushes-shared.dir/DependInfo.cmake"
+  "test/CMakeFiles/HDF5_TEST_LIB_files.dir/DependInfo.cmake"
+  "test/CMakeFiles/HDF5_TEST_LIBSH_files.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/H5make_libsettings"
+  "../bin/H5make_libsettings.pdb"
+  "CMakeFiles/H5make_libsettings.dir/H5make_libsettings.c.o"
+  "CMakeFiles/H5make_libsettings.dir/H5make_libsettings.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/H5make_libsettings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,623 @@
+file(REMOVE_RECURSE
+  "../bin/libhdf5.pdb"
+  "../bin/libhdf5.so"
+  "../bin/libhdf5.so.1.11.0"
+  "../bin/libhdf5.so.1000.0.0"
+  "../shared/H5Tinit.c"
+  "../shared/H5lib_settings.c"
+  "CMakeFiles/hdf5-shared.dir/H5.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5A.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5A.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5AC.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5AC.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5ACdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5ACdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5AClog.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5AClog.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5ACmpio.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5ACmpio.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5ACproxy_entry.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5ACproxy_entry.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Abtree2.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Abtree2.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Adense.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Adense.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Adeprec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Adeprec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Aint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Aint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Atest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Atest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B2.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B2.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B2cache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B2cache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B2dbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B2dbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B2hdr.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B2hdr.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B2int.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B2int.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B2internal.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B2internal.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B2leaf.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B2leaf.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B2stat.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B2stat.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5B2test.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5B2test.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Bcache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Bcache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Bdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Bdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5C.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5C.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5CS.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5CS.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Cdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Cdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Cepoch.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Cepoch.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Cimage.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Cimage.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Clog.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Clog.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Cmpio.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Cmpio.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Cprefetched.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Cprefetched.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Cquery.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Cquery.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ctag.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ctag.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ctest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ctest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5D.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5D.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dbtree.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dbtree.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dbtree2.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dbtree2.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dchunk.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dchunk.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dcompact.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dcompact.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dcontig.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dcontig.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ddbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ddbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ddeprec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ddeprec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dearray.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dearray.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Defl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Defl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dfarray.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dfarray.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dfill.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dfill.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dio.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dio.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dlayout.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dlayout.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dmpio.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dmpio.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dnone.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dnone.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Doh.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Doh.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dscatgath.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dscatgath.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dselect.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dselect.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dsingle.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dsingle.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dtest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dtest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Dvirtual.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Dvirtual.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5E.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5E.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EA.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EA.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAcache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAcache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAdblkpage.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAdblkpage.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAdblock.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAdblock.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAhdr.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAhdr.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAiblock.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAiblock.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAsblock.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAsblock.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAstat.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAstat.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5EAtest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5EAtest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Edeprec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Edeprec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Eint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Eint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5F.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5F.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FA.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FA.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FAcache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FAcache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FAdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FAdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FAdblkpage.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FAdblkpage.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FAdblock.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FAdblock.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FAhdr.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FAhdr.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FAint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FAint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FAstat.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FAstat.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FAtest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FAtest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FD.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FD.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDcore.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDcore.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDdirect.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDdirect.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDfamily.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDfamily.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDlog.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDlog.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDmmap.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDmmap.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDmpi.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDmpi.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDmpio.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDmpio.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDmulti.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDmulti.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDsec2.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDsec2.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDspace.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDspace.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDstdio.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDstdio.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDtest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDtest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDuring.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDuring.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FDwindows.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FDwindows.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FL.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FL.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FO.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FO.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FS.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FS.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FScache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FScache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FSdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FSdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FSint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FSint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FSsection.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FSsection.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FSstat.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FSstat.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5FStest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5FStest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Faccum.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Faccum.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fcwfs.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fcwfs.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fdeprec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fdeprec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fefc.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fefc.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ffake.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ffake.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fio.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fio.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fmount.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fmount.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fmpi.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fmpi.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fquery.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fquery.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fsfile.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fsfile.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fspace.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fspace.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fsuper.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fsuper.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Fsuper_cache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Fsuper_cache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ftest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ftest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5G.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5G.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gbtree2.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gbtree2.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gcache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gcache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gcompact.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gcompact.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gdense.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gdense.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gdeprec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gdeprec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gent.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gent.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Glink.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Glink.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gloc.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gloc.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gname.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gname.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gnode.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gnode.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gobj.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gobj.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Goh.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Goh.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Groot.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Groot.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gstab.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gstab.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gtest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gtest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Gtraverse.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Gtraverse.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HF.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HF.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFbtree2.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFbtree2.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFcache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFcache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFdblock.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFdblock.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFdtable.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFdtable.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFhdr.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFhdr.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFhuge.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFhuge.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFiblock.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFiblock.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFiter.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFiter.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFman.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFman.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFsection.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFsection.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFspace.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFspace.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFstat.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFstat.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFtest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFtest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HFtiny.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HFtiny.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HG.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HG.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HGcache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HGcache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HGdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HGdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HGquery.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HGquery.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HL.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HL.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HLcache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HLcache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HLdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HLdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HLdblk.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HLdblk.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HLint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HLint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HLprfx.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HLprfx.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5HP.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5HP.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5I.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5I.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Itest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Itest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5L.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5L.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Lexternal.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Lexternal.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5MF.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5MF.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5MFaggr.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5MFaggr.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5MFdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5MFdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5MFsection.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5MFsection.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5MM.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5MM.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5MP.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5MP.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5MPtest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5MPtest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5O.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5O.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oainfo.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oainfo.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oalloc.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oalloc.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oattr.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oattr.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oattribute.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oattribute.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Obogus.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Obogus.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Obtreek.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Obtreek.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ocache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ocache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ocache_image.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ocache_image.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ochunk.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ochunk.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ocont.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ocont.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ocopy.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ocopy.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Odbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Odbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Odrvinfo.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Odrvinfo.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Odtype.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Odtype.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oefl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oefl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ofill.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ofill.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oflush.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oflush.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ofsinfo.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ofsinfo.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oginfo.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oginfo.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Olayout.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Olayout.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Olinfo.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Olinfo.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Olink.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Olink.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Omessage.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Omessage.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Omtime.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Omtime.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oname.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oname.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Onull.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Onull.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Opline.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Opline.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Orefcount.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Orefcount.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Osdspace.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Osdspace.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oshared.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oshared.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Oshmesg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Oshmesg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ostab.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ostab.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Otest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Otest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ounknown.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ounknown.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5P.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5P.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5PB.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5PB.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5PL.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5PL.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5PLint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5PLint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5PLpath.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5PLpath.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5PLplugin_cache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5PLplugin_cache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pacpl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pacpl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pdapl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pdapl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pdcpl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pdcpl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pdeprec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pdeprec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pdxpl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pdxpl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pencdec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pencdec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pfapl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pfapl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pfcpl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pfcpl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pfmpl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pfmpl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pgcpl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pgcpl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Plapl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Plapl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Plcpl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Plcpl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pocpl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pocpl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pocpypl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pocpypl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Pstrcpl.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Pstrcpl.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ptest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ptest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5R.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5R.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5RQ.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5RQ.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5RQint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5RQint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5RS.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5RS.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Rdeprec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Rdeprec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Rint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Rint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5S.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5S.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5SL.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5SL.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5SM.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5SM.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5SMbtree2.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5SMbtree2.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5SMcache.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5SMcache.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5SMmessage.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5SMmessage.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5SMtest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5SMtest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5ST.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5ST.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Sall.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Sall.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Sdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Sdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Shyper.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Shyper.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Smpio.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Smpio.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Snone.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Snone.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Spoint.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Spoint.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Sselect.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Sselect.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Stest.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Stest.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5T.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5T.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5TP.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5TP.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5TS.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5TS.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tarray.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tarray.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tbit.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tbit.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tcommit.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tcommit.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tcompound.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tcompound.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tconv.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tconv.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tcset.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tcset.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tdbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tdbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tdeprec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tdeprec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tenum.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tenum.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tfields.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tfields.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tfixed.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tfixed.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tfloat.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tfloat.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tnative.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tnative.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Toffset.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Toffset.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Toh.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Toh.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Topaque.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Topaque.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Torder.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Torder.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tpad.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tpad.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tprecis.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tprecis.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tstrpad.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tstrpad.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tvec.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tvec.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tvisit.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tvisit.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Tvlen.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Tvlen.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5UC.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5UC.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5VM.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5VM.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5WB.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5WB.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Z.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Z.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Zcrc32c.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Zcrc32c.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Zdeflate.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Zdeflate.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Zfletcher32.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Zfletcher32.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Znbit.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Znbit.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Zscaleoffset.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Zscaleoffset.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Zshuffle.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Zshuffle.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Zszip.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Zszip.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5Ztrans.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5Ztrans.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5checksum.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5checksum.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5dbg.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5dbg.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5system.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5system.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5timer.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5timer.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/H5trace.c.o"
+  "CMakeFiles/hdf5-shared.dir/H5trace.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/__/shared/H5Tinit.c.o"
+  "CMakeFiles/hdf5-shared.dir/__/shared/H5Tinit.c.o.d"
+  "CMakeFiles/hdf5-shared.dir/__/shared/H5lib_settings.c.o"
+  "CMakeFiles/hdf5-shared.dir/__/shared/H5lib_settings.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf5-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()